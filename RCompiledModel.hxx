@@ -0,0 +1,104 @@
+#ifndef TMVA_SOFIE_RCOMPILEDMODEL
+#define TMVA_SOFIE_RCOMPILEDMODEL
+
+#include <vector>
+#include <string>
+#include <memory>
+#include <cstdint>
+
+namespace TMVA{
+namespace Experimental{
+namespace SOFIE{
+
+class RPerfCounters;
+
+//generated code of a model built into a shared object and loaded in process, returned by RModel::Compile.
+//Copies share the library, which is unloaded with the last one. The generated infer function keeps its intermediate
+//tensors in static storage: inferences of the same library must not run concurrently
+class RCompiledModel{
+
+private:
+
+   std::shared_ptr<void> fLibrary;       //dlopen handle
+   std::size_t (*fInfer)(float* const* inputs, float* output) = nullptr;
+   using ProfileFunction = std::size_t (*)(double* ns, std::uint64_t* calls, std::uint64_t* counters, std::size_t n,
+                                           std::size_t n_counters, int reset);
+   using ProfileCountersFunction = void (*)(void (*read)(void*, std::uint64_t*), void* context, const char* const* names,
+                                            std::size_t n);
+   ProfileFunction fProfile = nullptr;
+   ProfileCountersFunction fProfileCounters = nullptr;
+   using LatencyFunction = std::uint64_t (*)(const double* quantiles, double* values, std::size_t n);
+   LatencyFunction fLatency = nullptr;
+   const RPerfCounters* fCounters = nullptr;
+   std::vector<std::vector<std::size_t>> fInputShapes;
+   std::size_t fOutputLength = 0;
+   std::string fLibraryPath;
+   std::string fSymbol;
+   bool fFromCache = false;
+
+public:
+
+   struct ProfileEntry{
+      double ns = 0;               //summed over the profiled calls
+      std::uint64_t calls = 0;
+      std::vector<std::uint64_t> counters;   //summed as well, indexed by RPerfCounters::ECounter
+   };
+
+   //loads library and resolves symbol, the C entry point written by RModel::Compile
+   RCompiledModel(std::string library, std::string symbol, std::vector<std::vector<std::size_t>> input_shapes,
+                  std::size_t output_length, bool from_cache);
+
+   //inputs in the order of the arguments of the generated infer function
+   std::vector<float> Infer(const std::vector<const float*>& inputs) const;
+   std::vector<float> Infer(const float* input) const {
+      return Infer(std::vector<const float*>{input});
+   }
+
+   std::size_t GetNumInputs() const {
+      return fInputShapes.size();
+   }
+   const std::vector<std::size_t>& GetInputShape(std::size_t index) const {
+      return fInputShapes.at(index);
+   }
+   std::size_t GetOutputLength() const {
+      return fOutputLength;
+   }
+   const std::string& GetLibraryPath() const {
+      return fLibraryPath;
+   }
+   //entry point, to load a copy of the library with private static state
+   const std::string& GetSymbol() const {
+      return fSymbol;
+   }
+   //true when the shared object was found in the cache and nothing was compiled
+   bool IsFromCache() const {
+      return fFromCache;
+   }
+   //true for a model generated with Options::kProfile
+   bool HasProfile() const {
+      return fProfile != nullptr;
+   }
+   //time of each operator in execution order, then of the whole infer call, empty without a profile.
+   //reset starts the next profile from zero
+   std::vector<ProfileEntry> GetProfile(bool reset = false) const;
+   //reads counters around every profiled operator from now on, nullptr stops. counters must outlive the
+   //profiling and be read from the thread that opened them, which is the one running the inferences
+   void SetProfileCounters(const RPerfCounters* counters);
+   //true for a model generated with Options::kLatencyHistogram
+   bool HasLatencyHistogram() const {
+      return fLatency != nullptr;
+   }
+   //latency in ns of the inferences of this library so far at each quantile (e.g. 0.5, 0.99, 0.999), within 1/32,
+   //merged over the threads that ran them; count receives their number. Zeros without a latency histogram
+   std::vector<double> GetLatencyQuantiles(const std::vector<double>& quantiles, std::uint64_t* count = nullptr) const;
+
+   //instruction set extensions with a kernel of their own (e.g. "avx2 fma f16c") that the compile command of
+   //RModel::Compile targets, "scalar" when the kernels fall back to plain C++, empty when the compiler cannot be run
+   static std::string GetTargetFeatures(const std::string& command);
+};
+
+}//SOFIE
+}//Experimental
+}//TMVA
+
+#endif //TMVA_SOFIE_RCOMPILEDMODEL
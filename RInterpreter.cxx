@@ -0,0 +1,85 @@
+#include "RInterpreter.hxx"
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+
+namespace TMVA{
+namespace Experimental{
+namespace SOFIE{
+
+RInterpreter::RInterpreter(RModel&& model): fModel(std::move(model)){
+   if (!fModel.fGC.empty()){
+      //Initialize and Generate may have converted the weights and changed operator attributes
+      throw std::runtime_error("TMVA SOFIE model " + fModel.fName + " is already generated and cannot be interpreted");
+   }
+   if (!fModel.fInputTensorInfos.empty()){
+      throw std::runtime_error("TMVA SOFIE interpreter does not support inputs with unspecified dimension parameter in model " + fModel.fName);
+   }
+   fModel.fOptions = static_cast<std::underlying_type_t<Options>>(Options::kShapesOnly);
+   fModel.Initialize();
+
+   if (fModel.fOutputTensorNames.size() != 1){
+      throw std::runtime_error("TMVA SOFIE interpreter supports models with exactly 1 output tensor");
+   }
+   fOutput = fModel.GetTensorId(fModel.fOutputTensorNames[0]);
+   const RModel::TensorEntry& output = fModel.fTensors[fOutput];
+   if (output.kind != RModel::ETensorKind::kIntermediate || *output.type != ETensorType::FLOAT){
+      throw std::runtime_error("TMVA SOFIE interpreter output tensor " + output.name + " is not a float operator output");
+   }
+   fOutputLength = ConvertShapeToLength(*output.shape);
+
+   for (auto& i: fModel.fReadyInputTensorInfos){
+      if (i.second.type != ETensorType::FLOAT){
+         throw std::runtime_error("TMVA SOFIE interpreter input tensor " + i.first + " is not float");
+      }
+      fInputs.push_back(fModel.GetTensorId(i.first));
+   }
+
+   //intermediate tensors in order of creation, each rounded up to a cache line like the weight arena
+   const std::size_t alignment = 64;
+   std::vector<std::size_t> offsets(fModel.fTensors.size(), 0);
+   for (std::size_t id = 0; id < fModel.fTensors.size(); id++){
+      const RModel::TensorEntry& entry = fModel.fTensors[id];
+      if (entry.kind != RModel::ETensorKind::kIntermediate) continue;
+      offsets[id] = fArenaSize;
+      std::size_t bytes = ConvertShapeToLength(*entry.shape) * GetTypeSize(*entry.type);
+      fArenaSize += (bytes + alignment - 1) / alignment * alignment;
+   }
+   fArena = std::shared_ptr<void>(std::malloc(fArenaSize + alignment), std::free);
+   if (!fArena){
+      throw std::runtime_error("TMVA SOFIE failed to allocate the interpreter arena of " + std::to_string(fArenaSize) + " bytes");
+   }
+   char* arena = static_cast<char*>(fArena.get()) + (alignment - reinterpret_cast<std::uintptr_t>(fArena.get()) % alignment) % alignment;
+   std::memset(arena, 0, fArenaSize);
+
+   fData.assign(fModel.fTensors.size(), nullptr);
+   for (std::size_t id = 0; id < fModel.fTensors.size(); id++){
+      const RModel::TensorEntry& entry = fModel.fTensors[id];
+      if (entry.kind == RModel::ETensorKind::kIntermediate){
+         fData[id] = arena + offsets[id];
+      }else if (entry.kind == RModel::ETensorKind::kInitialized){
+         fData[id] = fModel.GetInitializedTensorData(entry.name).get();
+      }
+   }
+}
+
+std::vector<float> RInterpreter::Infer(const std::vector<const float*>& inputs){
+   if (inputs.size() != fInputs.size()){
+      throw std::runtime_error("TMVA SOFIE interpreter of model " + fModel.fName + " expects " + std::to_string(fInputs.size())
+                               + " inputs, got " + std::to_string(inputs.size()));
+   }
+   for (std::size_t i = 0; i < inputs.size(); i++){
+      fData[fInputs[i]] = const_cast<float*>(inputs[i]);   //only read by the operators
+   }
+   for (auto& op: fModel.fOperators){
+      op->Forward_reference(*this);
+   }
+   const float* output = GetTensorData<float>(fOutput);
+   return std::vector<float>(output, output + fOutputLength);
+}
+
+}//SOFIE
+}//Experimental
+}//TMVA
@@ -0,0 +1,63 @@
+#ifndef TMVA_SOFIE_RINTERPRETER
+#define TMVA_SOFIE_RINTERPRETER
+
+#include <vector>
+#include <memory>
+
+#include "SOFIE_common.hxx"
+#include "RModel.hxx"
+
+namespace TMVA{
+namespace Experimental{
+namespace SOFIE{
+
+//runs a parsed model in process, without generating and compiling code: every operator executes its
+//Forward_reference kernel on the tensors of a preallocated arena. The model is initialized for shapes only, so the
+//weights stay float and the results are those of the code generated with the default options.
+//An interpreter runs one inference at a time, the arena holds the tensors of the running one
+class RInterpreter{
+
+private:
+
+   RModel fModel;
+   std::vector<void*> fData;             //tensor data indexed by TensorId, graph inputs are bound by Infer
+   std::vector<TensorId> fInputs;        //in the order of the arguments of the generated infer function
+   TensorId fOutput = 0;
+   std::size_t fOutputLength = 0;
+   std::shared_ptr<void> fArena;         //intermediate tensors, each on a cache line
+   std::size_t fArenaSize = 0;
+   std::vector<float> fScratch;          //work space shared by the operators, grown by the first inference
+
+public:
+
+   RInterpreter(RModel&& model);
+
+   //disallow copy, the operators refer to the arena
+   RInterpreter(const RInterpreter& other) = delete;
+   RInterpreter& operator=(const RInterpreter& other) = delete;
+
+   //inputs in the order of the arguments of the generated infer function
+   std::vector<float> Infer(const std::vector<const float*>& inputs);
+   std::vector<float> Infer(const float* input){
+      return Infer(std::vector<const float*>{input});
+   }
+
+   template <typename T>
+   T* GetTensorData(TensorId id){
+      return static_cast<T*>(fData[id]);
+   }
+   //work space of the running operator, valid until the next call
+   float* GetScratch(std::size_t length){
+      if (fScratch.size() < length) fScratch.resize(length);
+      return fScratch.data();
+   }
+   std::size_t GetArenaSize() const {
+      return fArenaSize;
+   }
+};
+
+}//SOFIE
+}//Experimental
+}//TMVA
+
+#endif //TMVA_SOFIE_RINTERPRETER
@@ -1,4 +1,15 @@
 #include "RModel.hxx"
+#include "RInterpreter.hxx"
+
+#include <cmath>
+#include <algorithm>
+#include <limits>
+#include <thread>
+#include <cctype>
+#include <cstdlib>
+#include <cstddef>
+#include <cstring>
+#include <random>
 
 
 
@@ -7,17 +18,113 @@ namespace TMVA{
 namespace Experimental{
 namespace SOFIE{
 
+   namespace{
+   //values [begin, end) of an initialized tensor, with the opening brace of its member of the weight arena before the first one and the closing brace after the last one
+   struct TensorChunk{
+      const InitializedTensor* tensor;
+      std::size_t begin;
+      std::size_t end;
+      std::string text;
+   };
+
+   //element type of an initialized tensor in the generated code, empty for the types that are not emitted
+   std::string EmittedType(ETensorType type){
+      switch (type){
+         case ETensorType::FLOAT: return "float";
+         case ETensorType::INT8: return "std::int8_t";
+         case ETensorType::INT32: return "std::int32_t";
+         case ETensorType::FLOAT16: case ETensorType::BFLOAT16: return "std::uint16_t";   //bit patterns
+         default: return "";
+      }
+   }
+
+   std::string FileStem(const std::string& filename){
+      std::size_t dot = filename.find_last_of('.');
+      std::size_t slash = filename.find_last_of("/\\");
+      return (dot == std::string::npos || (slash != std::string::npos && dot < slash)) ? filename : filename.substr(0, dot);
+   }
+
+   std::string FileBasename(const std::string& filename){
+      std::size_t slash = filename.find_last_of("/\\");
+      return slash == std::string::npos ? filename : filename.substr(slash + 1);
+   }
+
+   void AppendInteger(std::string& out, long long value){
+      char digits[24];
+      int n = 0;
+      unsigned long long magnitude = value < 0 ? 0ull - static_cast<unsigned long long>(value) : value;
+      do{
+         digits[n++] = '0' + magnitude % 10;
+         magnitude /= 10;
+      }while(magnitude != 0);
+      if (value < 0) out += '-';
+      while (n > 0) out += digits[--n];
+   }
+
+   void AppendHex(std::string& out, std::uint16_t value){
+      static const char digits[] = "0123456789abcdef";
+      if (value == 0){
+         out += '0';
+         return;
+      }
+      out += "0x";
+      int shift = 12;
+      while ((value >> shift) == 0) shift -= 4;
+      for (; shift >= 0; shift -= 4) out += digits[(value >> shift) & 0xf];
+   }
+
+   void FormatChunk(TensorChunk& chunk, bool hexfloat){
+      const InitializedTensor& tensor = *chunk.tensor;
+      std::string& out = chunk.text;
+      if (chunk.begin == 0) out += "{";
+      out.reserve(out.size() + (chunk.end - chunk.begin) * 16);
+      for (std::size_t idx = chunk.begin; idx < chunk.end; idx++){
+         if (idx > 0) out += ", ";
+         switch (tensor.type){
+            case ETensorType::FLOAT: {
+               //the data may be a misaligned view of the model file
+               float value;
+               std::memcpy(&value, static_cast<const char*>(tensor.data.get()) + idx * sizeof(float), sizeof(float));
+               hexfloat ? UTILITY::AppendHexFloatLiteral(out, value) : UTILITY::AppendFloatLiteral(out, value);
+               break;
+            }
+            case ETensorType::INT8: AppendInteger(out, static_cast<const std::int8_t*>(tensor.data.get())[idx]); break;
+            case ETensorType::INT32: AppendInteger(out, static_cast<const std::int32_t*>(tensor.data.get())[idx]); break;
+            default: AppendHex(out, static_cast<const std::uint16_t*>(tensor.data.get())[idx]);
+         }
+      }
+      if (chunk.end == ConvertShapeToLength(tensor.shape)) out += "},\n";
+   }
+   }//anonymous namespace
+
    RModel::RModel(RModel&& other){
       fInputTensorInfos = std::move(other.fInputTensorInfos);
       fReadyInputTensorInfos = std::move(other.fReadyInputTensorInfos);
       fOperators = std::move(other.fOperators);
       fInitializedTensors = std::move(other.fInitializedTensors);
+      fIntermediateTensorInfos = std::move(other.fIntermediateTensorInfos);
+      fTensors = std::move(other.fTensors);
+      fTensorIds = std::move(other.fTensorIds);
+      fActivationRanges = std::move(other.fActivationRanges);
+      fWeightConversions = std::move(other.fWeightConversions);
+      fOutputAccuracy = std::move(other.fOutputAccuracy);
       fName = other.fName;
       fFileName = other.fFileName;
       fParseTime = other.fParseTime;
       fGC = other.fGC;
       fNeededStdLib = other.fNeededStdLib;
+      fNeededBlasRoutines = other.fNeededBlasRoutines;
       fOutputTensorNames = other.fOutputTensorNames;
+      fOptions = other.fOptions;
+      fModelCodePosition = other.fModelCodePosition;
+      fInitializedTensorsPosition = other.fInitializedTensorsPosition;
+      fInferBodyPosition = other.fInferBodyPosition;
+      fWeightOrder = std::move(other.fWeightOrder);
+      fWeightArenaSize = other.fWeightArenaSize;
+      fSparseWeightThreshold = other.fSparseWeightThreshold;
+      fSparseInputLayers = other.fSparseInputLayers;
+      fSparseInputDensity = other.fSparseInputDensity;
+      fTensorReaders = std::move(other.fTensorReaders);
    }
 
    RModel& RModel::operator=(RModel&& other){
@@ -25,12 +132,29 @@ namespace SOFIE{
       fReadyInputTensorInfos = std::move(other.fReadyInputTensorInfos);
       fOperators = std::move(other.fOperators);
       fInitializedTensors = std::move(other.fInitializedTensors);
+      fIntermediateTensorInfos = std::move(other.fIntermediateTensorInfos);
+      fTensors = std::move(other.fTensors);
+      fTensorIds = std::move(other.fTensorIds);
+      fActivationRanges = std::move(other.fActivationRanges);
+      fWeightConversions = std::move(other.fWeightConversions);
+      fOutputAccuracy = std::move(other.fOutputAccuracy);
       fName = other.fName;
       fFileName = other.fFileName;
       fParseTime = other.fParseTime;
       fGC = other.fGC;
       fNeededStdLib = other.fNeededStdLib;
+      fNeededBlasRoutines = other.fNeededBlasRoutines;
       fOutputTensorNames = other.fOutputTensorNames;
+      fOptions = other.fOptions;
+      fModelCodePosition = other.fModelCodePosition;
+      fInitializedTensorsPosition = other.fInitializedTensorsPosition;
+      fInferBodyPosition = other.fInferBodyPosition;
+      fWeightOrder = std::move(other.fWeightOrder);
+      fWeightArenaSize = other.fWeightArenaSize;
+      fSparseWeightThreshold = other.fSparseWeightThreshold;
+      fSparseInputLayers = other.fSparseInputLayers;
+      fSparseInputDensity = other.fSparseInputDensity;
+      fTensorReaders = std::move(other.fTensorReaders);
       return *this;
    }
 
@@ -38,53 +162,86 @@ namespace SOFIE{
       fName = fFileName.substr(0, fFileName.rfind("."));
    }
 
-   const std::vector<size_t>& RModel::GetTensorShape(std::string name){
-      auto f = fReadyInputTensorInfos.find(name);
-      if (f != fReadyInputTensorInfos.end()){
-         return f->second.shape;
+   void RModel::Reserve(std::size_t n_tensors, std::size_t n_operators){
+      fTensors.reserve(n_tensors);
+      fTensorIds.reserve(n_tensors);
+      fOperators.reserve(n_operators);
+   }
+
+   const RModel::TensorEntry* RModel::FindTensor(const std::string& name) const {
+      auto f = fTensorIds.find(name);
+      if (f == fTensorIds.end() || fTensors[f->second].kind == ETensorKind::kNone) return nullptr;
+      return &fTensors[f->second];
+   }
+
+   void RModel::RegisterTensor(const std::string& name, ETensorKind kind, const ETensorType* type, const std::vector<size_t>* shape){
+      auto f = fTensorIds.find(name);
+      if (f == fTensorIds.end()){
+         if (fTensors.size() > std::numeric_limits<TensorId>::max()){
+            throw std::runtime_error("TMVA-SOFIE: too many tensors in model " + fName);
+         }
+         f = fTensorIds.emplace(name, static_cast<TensorId>(fTensors.size())).first;
+         fTensors.emplace_back();
+         fTensors.back().name = name;
       }
-      auto f2 = fInitializedTensors.find(name);
-      if (f2 != fInitializedTensors.end()){
-         return f2->second.shape;
+      TensorEntry& entry = fTensors[f->second];
+      entry.kind = kind;
+      entry.type = type;
+      entry.shape = shape;
+   }
+
+   TensorId RModel::GetTensorId(const std::string& name){
+      auto f = fTensorIds.find(name);
+      if (f == fTensorIds.end() || fTensors[f->second].kind == ETensorKind::kNone){
+         throw std::runtime_error("TMVA SOFIE tensor [" + name + "] is not found");
       }
-      auto f3 = fInputTensorInfos.find(name);
-      if (f3 != fInputTensorInfos.end()){
-         throw std::runtime_error("TMVA SOFIE tensor [" + name + "] is an input tensor with unspecified dimension parameter");
+      return f->second;
+   }
+
+   const std::vector<size_t>& RModel::GetTensorShape(TensorId id){
+      const TensorEntry& entry = fTensors[id];
+      if (entry.kind == ETensorKind::kInput){
+         throw std::runtime_error("TMVA SOFIE tensor [" + entry.name + "] is an input tensor with unspecified dimension parameter");
       }
-      auto f4 = fIntermediateTensorInfos.find(name);
-      if (f4 != fIntermediateTensorInfos.end()){
-         return f4->second.shape;
+      if (entry.kind == ETensorKind::kNone){
+         throw std::runtime_error("TMVA SOFIE tensor [" + entry.name + "] for which the shape is requested is not found");
       }
-
-      throw std::runtime_error("TMVA SOFIE tensor [" + name + "] for which the shape is requested is not found");
+      return *entry.shape;
    }
 
-   const ETensorType& RModel::GetTensorType(std::string name){
-      auto f = fReadyInputTensorInfos.find(name);
-      if (f != fReadyInputTensorInfos.end()){
-         return f->second.type;
-      }
-      auto f2 = fInitializedTensors.find(name);
-      if (f2 != fInitializedTensors.end()){
-         return f2->second.type;
+   const std::vector<size_t>& RModel::GetTensorShape(const std::string& name){
+      auto f = fTensorIds.find(name);
+      if (f == fTensorIds.end()){
+         throw std::runtime_error("TMVA SOFIE tensor [" + name + "] for which the shape is requested is not found");
       }
-      auto f3 = fInputTensorInfos.find(name);
-      if (f3 != fInputTensorInfos.end()){
-         return f3->second.type;
+      return GetTensorShape(f->second);
+   }
+
+   const ETensorType& RModel::GetTensorType(TensorId id){
+      const TensorEntry& entry = fTensors[id];
+      if (entry.kind == ETensorKind::kNone){
+         throw std::runtime_error("TMVA SOFIE tensor [" + entry.name + "] for which the shape is requested is not found");
       }
-      auto f4 = fIntermediateTensorInfos.find(name);
-      if (f4 != fIntermediateTensorInfos.end()){
-         return f4->second.type;
+      return *entry.type;
+   }
+
+   const ETensorType& RModel::GetTensorType(const std::string& name){
+      auto f = fTensorIds.find(name);
+      if (f == fTensorIds.end()){
+         throw std::runtime_error("TMVA SOFIE tensor [" + name + "] for which the shape is requested is not found");
       }
+      return GetTensorType(f->second);
+   }
 
-      throw std::runtime_error("TMVA SOFIE tensor [" + name + "] for which the shape is requested is not found");
+   bool RModel::CheckIfTensorAlreadyExist(const std::string& tensor_name){
+      //graph inputs with a dimension parameter are not ready to be used by the operators
+      const TensorEntry* entry = FindTensor(tensor_name);
+      return entry != nullptr && entry->kind != ETensorKind::kInput;
    }
 
-   bool RModel::CheckIfTensorAlreadyExist(std::string tensor_name){
-      if (fReadyInputTensorInfos.find(tensor_name) != fReadyInputTensorInfos.end())  return true;
-      if (fInitializedTensors.find(tensor_name) != fInitializedTensors.end()) return true;
-      if (fIntermediateTensorInfos.find(tensor_name) != fIntermediateTensorInfos.end()) return true;
-      return false;
+   bool RModel::IsInitializedTensor(const std::string& tensor_name){
+      const TensorEntry* entry = FindTensor(tensor_name);
+      return entry != nullptr && entry->kind == ETensorKind::kInitialized;
    }
 
    void RModel::AddInputTensorInfo(std::string input_name, ETensorType type, std::vector<Dim> shape){
@@ -93,8 +250,9 @@ namespace SOFIE{
          throw std::runtime_error("TMVA-SOFIE: input tensor with name " + input_name + " already exists \n");
       }
 
-      InputTensorInfo inputInfo { type, shape };
-      fInputTensorInfos[input_name] = inputInfo;
+      InputTensorInfo& inputInfo = fInputTensorInfos[input_name];
+      inputInfo = InputTensorInfo{ type, shape };
+      RegisterTensor(input_name, ETensorKind::kInput, &inputInfo.type, nullptr);
    }
 
    void RModel::AddInputTensorInfo(std::string input_name, ETensorType type, std::vector<size_t> shape){
@@ -102,8 +260,9 @@ namespace SOFIE{
       if (CheckIfTensorAlreadyExist(input_name)){
          throw std::runtime_error("TMVA-SOFIE: input tensor with name " + input_name + " already exists \n");
       }
-      TensorInfo inputInfo { type, shape };
-      fReadyInputTensorInfos[input_name] = inputInfo;
+      TensorInfo& inputInfo = fReadyInputTensorInfos[input_name];
+      inputInfo = TensorInfo{ type, shape };
+      RegisterTensor(input_name, ETensorKind::kReadyInput, &inputInfo.type, &inputInfo.shape);
    }
 
    void RModel::AddOperator(std::unique_ptr<ROperator> op, int order_execution){
@@ -120,18 +279,23 @@ namespace SOFIE{
       if (CheckIfTensorAlreadyExist(tensor_name)){
          throw std::runtime_error("TMVA-SOFIE: initialized tensor with name " + tensor_name + " already exists \n");
       }
-      InitializedTensor new_tensor {type, shape, data};
-      fInitializedTensors[tensor_name] = new_tensor;
-
+      InitializedTensor& new_tensor = fInitializedTensors[tensor_name];
+      new_tensor = InitializedTensor{type, std::move(shape), std::move(data)};
+      RegisterTensor(tensor_name, ETensorKind::kInitialized, &new_tensor.type, &new_tensor.shape);
    }
 
    void RModel::AddIntermediateTensor(std::string tensor_name, ETensorType type, std::vector<std::size_t> shape){
       tensor_name = UTILITY::Clean_name(tensor_name);
-      if (CheckIfTensorAlreadyExist(tensor_name)){
+      const TensorEntry* existing = FindTensor(tensor_name);
+      if (existing != nullptr && existing->kind == ETensorKind::kIntermediate && *existing->type == type && *existing->shape == shape){
+         return;   //model initialized again, e.g. loaded from a snapshot
+      }
+      if (existing != nullptr && existing->kind != ETensorKind::kInput){
          throw std::runtime_error("TMVA-SOFIE: intermediate tensor with name " + tensor_name + " already exists \n");
       }
-      TensorInfo new_tensor {type, shape};
-      fIntermediateTensorInfos[tensor_name] = new_tensor;
+      TensorInfo& new_tensor = fIntermediateTensorInfos[tensor_name];
+      new_tensor = TensorInfo{type, std::move(shape)};
+      RegisterTensor(tensor_name, ETensorKind::kIntermediate, &new_tensor.type, &new_tensor.shape);
    }
 
    void RModel::UpdateInitializedTensor(std::string tensor_name, ETensorType type, std::vector<std::size_t> shape, std::shared_ptr<void> data){
@@ -139,68 +303,245 @@ namespace SOFIE{
       if (not CheckIfTensorAlreadyExist(tensor_name)){
          throw std::runtime_error("TMVA-SOFIE: tensor " + tensor_name + " not found when trying to update it");
       }
-      InitializedTensor new_tensor {type, shape, data};
-      fInitializedTensors[tensor_name] = new_tensor;
+      InitializedTensor& new_tensor = fInitializedTensors[tensor_name];
+      new_tensor = InitializedTensor{type, std::move(shape), std::move(data)};
+      RegisterTensor(tensor_name, ETensorKind::kInitialized, &new_tensor.type, &new_tensor.shape);
    }
 
-   std::shared_ptr<void> RModel::GetInitializedTensorData(std::string tensor_name){
+   void RModel::RemoveInitializedTensor(std::string tensor_name){
+      tensor_name = UTILITY::Clean_name(tensor_name);
+      if (fInitializedTensors.erase(tensor_name) == 0){
+         throw std::runtime_error("TMVA-SOFIE: tensor " + tensor_name + " not found when trying to remove it");
+      }
+      RegisterTensor(tensor_name, ETensorKind::kNone, nullptr, nullptr);
+   }
+
+   std::shared_ptr<void> RModel::GetInitializedTensorBytes(const std::string& tensor_name){
       auto f = fInitializedTensors.find(tensor_name);
       if (f == fInitializedTensors.end()){
          throw std::runtime_error("TMVA-SOFIE: tensor " + tensor_name + " not found when trying to get its data");
-      }else{
-         return f->second.data;
+      }
+      return f->second.data;
+   }
+
+   std::shared_ptr<void> RModel::GetInitializedTensorData(const std::string& tensor_name){
+      auto f = fInitializedTensors.find(tensor_name);
+      if (f == fInitializedTensors.end()){
+         throw std::runtime_error("TMVA-SOFIE: tensor " + tensor_name + " not found when trying to get its data");
+      }
+      InitializedTensor& tensor = f->second;
+      std::size_t alignment = std::min(GetTypeSize(tensor.type), alignof(std::max_align_t));
+      if (alignment > 1 && reinterpret_cast<std::uintptr_t>(tensor.data.get()) % alignment != 0){
+         std::size_t size = ConvertShapeToLength(tensor.shape) * GetTypeSize(tensor.type);
+         std::shared_ptr<void> aligned(malloc(size), free);
+         std::memcpy(aligned.get(), tensor.data.get(), size);
+         tensor.data = aligned;
+      }
+      return tensor.data;
+   }
+
+   void RModel::AddActivationRange(std::string tensor_name, float min, float max){
+      tensor_name = UTILITY::Clean_name(tensor_name);
+      fActivationRanges[tensor_name] = std::make_pair(min, max);
+   }
+
+   bool RModel::GetActivationRange(std::string tensor_name, float& min, float& max){
+      auto f = fActivationRanges.find(tensor_name);
+      if (f == fActivationRanges.end()) return false;
+      min = f->second.first;
+      max = f->second.second;
+      return true;
+   }
+
+   void RModel::ReadCalibration(std::string filename){
+      std::ifstream f(filename);
+      if (!f.is_open()){
+         throw std::runtime_error("TMVA-SOFIE: failed to open calibration file " + filename);
+      }
+      std::string tensor_name;
+      float min, max;
+      while (f >> tensor_name >> min >> max){
+         AddActivationRange(tensor_name, min, max);
       }
    }
 
+   void RModel::AddWeightConversionInfo(std::string tensor_name, ETensorType type, const float* original, const float* converted, std::size_t length){
+      tensor_name = UTILITY::Clean_name(tensor_name);
+      WeightConversionInfo info {type, length, 0., 0., 0.};
+      for (std::size_t i = 0; i < length; i++){
+         double error = std::fabs(static_cast<double>(original[i]) - converted[i]);
+         info.max_abs_error = std::max(info.max_abs_error, error);
+         info.rms_error += error * error;
+         info.rms += static_cast<double>(original[i]) * original[i];
+      }
+      if (length > 0){
+         info.rms_error = std::sqrt(info.rms_error / length);
+         info.rms = std::sqrt(info.rms / length);
+      }
+      fWeightConversions[tensor_name] = info;
+   }
+
+   void RModel::CheckOutputAccuracy(RInterpreter& reference, const RCompiledModel& compiled, std::size_t samples, unsigned seed){
+      if (fOutputTensorNames.size() != 1){
+         throw std::runtime_error("TMVA SOFIE output accuracy check supports models with exactly 1 output tensor");
+      }
+      std::mt19937 generator(seed);
+      std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+      std::vector<std::vector<float>> inputs(compiled.GetNumInputs());
+      std::vector<const float*> pointers;
+      for (std::size_t i = 0; i < inputs.size(); i++){
+         inputs[i].resize(ConvertShapeToLength(compiled.GetInputShape(i)));
+         pointers.push_back(inputs[i].data());
+      }
+      OutputAccuracyInfo info {compiled.GetOutputLength(), samples, 0., 0., 0.};
+      for (std::size_t s = 0; s < samples; s++){
+         for (auto& input: inputs){
+            for (auto& x: input) x = distribution(generator);
+         }
+         std::vector<float> expected = reference.Infer(pointers);
+         std::vector<float> output = compiled.Infer(pointers);
+         if (expected.size() != output.size()){
+            throw std::runtime_error("TMVA SOFIE output of the compiled model " + fName + " has " + std::to_string(output.size())
+                                     + " values, the reference " + std::to_string(expected.size()));
+         }
+         for (std::size_t i = 0; i < output.size(); i++){
+            double error = std::fabs(static_cast<double>(expected[i]) - output[i]);
+            info.max_abs_error = std::max(info.max_abs_error, error);
+            info.rms_error += error * error;
+            info.rms += static_cast<double>(expected[i]) * expected[i];
+         }
+      }
+      std::size_t n = info.length * samples;
+      if (n > 0){
+         info.rms_error = std::sqrt(info.rms_error / n);
+         info.rms = std::sqrt(info.rms / n);
+      }
+      fOutputAccuracy[fOutputTensorNames[0]] = info;
+   }
+
    void RModel::Initialize(){
+      fTensorReaders.clear();
+      for (auto& i : fOperators){
+         for (auto& name: i->GetInputTensorNames()) fTensorReaders[name]++;
+      }
       for (auto& i : fOperators){
          i->Initialize(*this);
       }
    }
 
-   void RModel::Generate(){
+   std::vector<std::string> RModel::GetPreambleBlocks(){
+      std::vector<std::string> blocks;
+      for (auto& i: fNeededStdLib){
+         blocks.push_back("#include<" + i + ">\n");
+      }
+      if (fUseEigen) blocks.push_back("#include <Eigen/Dense>\n");
+      if (UseOption(Options::kHugePageWeights)){
+         blocks.push_back("#include <cstdint>\n"
+                          "#if defined(__linux__)\n"
+                          "#include <sys/mman.h>\n"
+                          "#endif\n"
+                          "#ifndef TMVA_SOFIE_WEIGHT_SECTION\n"
+                          "#if defined(__ELF__)\n"
+                          "#define TMVA_SOFIE_WEIGHT_SECTION __attribute__((section(\"sofie_weights\")))\n"
+                          "extern \"C\" const char __start_sofie_weights[], __stop_sofie_weights[];\n"
+                          "#else\n"
+                          "#define TMVA_SOFIE_WEIGHT_SECTION\n"
+                          "#endif\n"
+                          "#endif\n");
+      }
+      if (UseOption(Options::kProfile)){
+         blocks.push_back("#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))\n"
+                          "#include <intrin.h>\n"
+                          "#define TMVA_SOFIE_RDTSC\n"
+                          "#elif defined(__x86_64__) || defined(__i386__)\n"
+                          "#include <x86intrin.h>\n"
+                          "#define TMVA_SOFIE_RDTSC\n"
+                          "#endif\n");
+      }
+      //helper kernels requested by the operators, each emitted once
+      std::set<std::string> emitted_headers;
+      for (auto& op: fOperators){
+         std::string header = op->Header();
+         if (header.empty() || !emitted_headers.insert(header).second) continue;
+         blocks.push_back(header);
+      }
+      return blocks;
+   }
+
+   std::string RModel::GetBlasDeclarations(const std::set<std::string>& routines){
+      std::string declarations;
+      for (auto &routine : routines) {
+         if (routine == "Gemm") {
+            declarations += ("\textern \"C\" void sgemm_(const char * transa, const char * transb, const int * m, const int * n, const int * k,\n"
+                             "\t                       const float * alpha, const float * A, const int * lda, const float * B, const int * ldb,\n"
+                             "\t                       const float * beta, float * C, const int * ldc);\n");
+         } else if (routine == "Sgemv") {
+            declarations += ("\textern \"C\" void sgemv_(const char * trans, const int * m, const int * n, const float * alpha, const float * A,\n"
+                             "\t                       const int * lda, const float * X, const int * incx, const float * beta, const float * Y, const int * incy);\n");
+         } else if (routine == "Axpy") {
+            declarations += ("\textern \"C\" void saxpy_(const int * n, const float * alpha, const float * x,\n"
+                             "\t                         const int * incx, float * y, const int * incy);\n");
+         }
+      }
+      return declarations;
+   }
+
+   void RModel::Generate(std::underlying_type_t<Options> options){
+      fOptions = options;
+      if (UseOption(Options::kCalibration)){
+         AddNeededStdLib("fstream");
+         AddNeededStdLib("limits");
+         AddNeededStdLib("string");
+      }
+      if (UseOption(Options::kCInterface)){
+         AddNeededStdLib("algorithm");
+         AddNeededStdLib("cstdint");
+         AddNeededStdLib("mutex");
+      }
+      if (UseOption(Options::kSwappableWeights)){
+         for (std::string lib: {"atomic", "cstdint", "cstdlib", "fstream", "memory", "new", "stdexcept", "string"}){
+            AddNeededStdLib(lib);
+         }
+      }
+      if (UseOption(Options::kProfile)){
+         for (std::string lib: {"algorithm", "chrono", "cmath", "cstdint", "fstream", "iostream", "stdexcept", "string"}){
+            AddNeededStdLib(lib);
+         }
+      }
+      if (UseOption(Options::kLatencyHistogram)){
+         for (std::string lib: {"algorithm", "atomic", "chrono", "cmath", "cstdint"}){
+            AddNeededStdLib(lib);
+         }
+      }
       Initialize();
       fGC += ("//Code generated automatically by TMVA for Inference of Model file [" + fFileName + "] at [" + fParseTime.substr(0, fParseTime.length()-1) +"] \n");
-      for (auto& i: fNeededStdLib){
-         fGC += "#include<" + i + ">\n";
+      for (auto& block: GetPreambleBlocks()){
+         fGC += block;
       }
-      if (fUseEigen) fGC += "#include <Eigen/Dense>\n";
       fGC += ("namespace TMVA_SOFIE_" + fName + "{\n");
       //if (fNeedGemm) {
       if (!fNeededBlasRoutines.empty()) {
-         fGC += ("namespace BLAS{\n");
-         for (auto &routine : fNeededBlasRoutines) {
-            if (routine == "Gemm") {
-               fGC += ("\textern \"C\" void sgemm_(const char * transa, const char * transb, const int * m, const int * n, const int * k,\n"
-                       "\t                       const float * alpha, const float * A, const int * lda, const float * B, const int * ldb,\n"
-                       "\t                       const float * beta, float * C, const int * ldc);\n");
-            } else if (routine == "Sgemv") {
-               fGC += ("\textern \"C\" void sgemv_(const char * trans, const int * m, const int * n, const float * alpha, const float * A,\n"
-                       "\t                       const int * lda, const float * X, const int * incx, const float * beta, const float * Y, const int * incy);\n");
-            } else if (routine == "Axpy") {
-               fGC += ("\textern \"C\" void saxpy_(const int * n, const float * alpha, const float * x,\n"
-                       "\t                         const int * incx, float * y, const int * incy);\n");
-            }
-            fGC += ("}//BLAS\n");
-         }
+         fGC += ("namespace BLAS{\n") + GetBlasDeclarations(fNeededBlasRoutines) + ("}//BLAS\n");
       }
+      fModelCodePosition = fGC.size();
 
-      for (auto& i: fInitializedTensors){
-         if (i.second.type == ETensorType::FLOAT){
-            size_t length = 1;
-            for (auto & dim: i.second.shape){
-               length *= dim;
-            }
-            fGC += "float tensor_" + i.first + "[" + std::to_string(length) + "] = {";
-            std::shared_ptr<float> data = std::static_pointer_cast<float>(i.second.data);
-            std::stringstream floats;
-            for (int idx = 0; idx < length-1; idx++){
-               floats << std::setprecision(std::numeric_limits<float>::max_digits10) << data.get()[idx] << ", ";
-            }
-            floats << std::setprecision(std::numeric_limits<float>::max_digits10) << data.get()[length-1];
-            fGC += floats.str() +"};\n";
-         }
+      if (UseOption(Options::kHugePageWeights)){
+         //the weights of all the models share the sofie_weights section, which starts on a huge page
+         fGC += "#if defined(__ELF__)\n"
+                "__asm__(\".pushsection sofie_weights,\\\"a\\\"\\n\\t.balign 2097152\\n\\t.popsection\");\n"
+                "#endif\n";
+         fGC += "//asks the kernel to back the weight section with transparent huge pages, where file mappings support them\n"
+                "inline void AdviseHugePages(){\n"
+                "#if defined(__ELF__) && defined(MADV_HUGEPAGE)\n"
+                "\tconst std::uintptr_t huge_page = 2097152;\n"
+                "\tstd::uintptr_t begin = (reinterpret_cast<std::uintptr_t>(__start_sofie_weights) + huge_page - 1) & ~(huge_page - 1);\n"
+                "\tstd::uintptr_t end = reinterpret_cast<std::uintptr_t>(__stop_sofie_weights) & ~(huge_page - 1);\n"
+                "\tif (end > begin) madvise(reinterpret_cast<void*>(begin), end - begin, MADV_HUGEPAGE);\n"
+                "#endif\n"
+                "}\n";
       }
+      //weights are formatted when the code is written out, see WriteInitializedTensors
+      fInitializedTensorsPosition = fGC.size();
       for (auto&i: fIntermediateTensorInfos){
          if (i.second.type == ETensorType::FLOAT){
             size_t length = 1;
@@ -211,6 +552,45 @@ namespace SOFIE{
          }
       }
 
+      if (UseOption(Options::kCalibration)){
+         //running [min, max] of every activation, graph inputs are bound at the beginning of each infer call
+         fGC += "namespace Calibration{\n";
+         fGC += "const std::size_t n_inputs = " + std::to_string(fReadyInputTensorInfos.size()) + ";   //the first ranges\n";
+         fGC += "struct Range { const char* name; const float* data; std::size_t length; float min; float max; };\n";
+         fGC += "Range ranges[] = {\n";
+         for (auto& i: fReadyInputTensorInfos){
+            fGC += "\t{\"" + i.first + "\", nullptr, " + std::to_string(ConvertShapeToLength(i.second.shape))
+                 + ", std::numeric_limits<float>::max(), std::numeric_limits<float>::lowest()},\n";
+         }
+         for (auto& i: fIntermediateTensorInfos){
+            fGC += "\t{\"" + i.first + "\", tensor_" + i.first + ", " + std::to_string(ConvertShapeToLength(i.second.shape))
+                 + ", std::numeric_limits<float>::max(), std::numeric_limits<float>::lowest()},\n";
+         }
+         fGC += "};\n";
+         fGC += "void update(){\n";
+         fGC += "\tfor (auto& r: ranges){\n";
+         fGC += "\t\tfor (std::size_t id = 0; id < r.length; id++){\n";
+         fGC += "\t\t\tr.min = std::min(r.min, r.data[id]);\n";
+         fGC += "\t\t\tr.max = std::max(r.max, r.data[id]);\n";
+         fGC += "\t\t}\n";
+         fGC += "\t}\n";
+         fGC += "}\n";
+         fGC += "void write(std::string filename){\n";
+         fGC += "\tstd::ofstream f(filename);\n";
+         fGC += "\tf.precision(std::numeric_limits<float>::max_digits10);\n";
+         fGC += "\tfor (auto& r: ranges){\n";
+         fGC += "\t\tf << r.name << \" \" << r.min << \" \" << r.max << \"\\n\";\n";
+         fGC += "\t}\n";
+         fGC += "}\n";
+         fGC += "}//Calibration\n";
+      }
+      if (UseOption(Options::kProfile)){
+         fGC += GenerateProfiler();
+      }
+      if (UseOption(Options::kLatencyHistogram)){
+         fGC += GenerateLatencyHistogram();
+      }
+
       if (fOutputTensorNames.size() == 1){
          auto f = fIntermediateTensorInfos.find(fOutputTensorNames[0]);
          if (f == fIntermediateTensorInfos.end()){
@@ -234,20 +614,568 @@ namespace SOFIE{
          if (i.second.type == ETensorType::FLOAT){
          fGC += "float* tensor_" + i.first + ",";
          }
-         fGC.pop_back(); //remove last ","
       }
+      if (!fReadyInputTensorInfos.empty()) fGC.pop_back(); //remove last ","
       fGC += "){\n";
+      if (UseOption(Options::kLatencyHistogram)){
+         fGC += "\tconst std::uint64_t latency_start = Latency::now();\n";
+      }
+      fInferBodyPosition = fGC.size();
 
+      if (UseOption(Options::kCalibration)){
+         int idx = 0;
+         for (auto& i: fReadyInputTensorInfos){
+            fGC += "\tCalibration::ranges[" + std::to_string(idx++) + "].data = tensor_" + i.first + ";\n";
+         }
+      }
+
+      bool profile = UseOption(Options::kProfile);
+      if (profile){
+         fGC += "\tconst bool profile = Profile::begin();\n";
+         fGC += "\tconst std::uint64_t profile_tick = profile ? Profile::start(" + std::to_string(fOperators.size()) + ") : 0;\n";
+      }
+
+      std::vector<char> used_tensors(fTensors.size(), false);
+      std::vector<std::string> weight_order;
       for (int id = 0; id < fOperators.size() ; id++){
-         fGC+= (fOperators[id]->Generate(std::to_string(id)));
+         std::string op_name = "op_" + std::to_string(id);
+         std::string op_code = fOperators[id]->Generate(std::to_string(id));
+         AppendUsedTensors(op_code, used_tensors, weight_order);
+         if (profile){
+            fGC += "\tconst std::uint64_t " + op_name + "_tick = profile ? Profile::start(" + std::to_string(id) + ") : 0;\n";
+         }
+         fGC += op_code;
+         if (profile){
+            fGC += "\tif (profile) Profile::record(" + std::to_string(id) + ", " + op_name + "_tick, Profile::ticks());\n";
+         }
+      }
+      LayoutWeightArena(weight_order);
+      if (UseOption(Options::kSwappableWeights)){
+         //the weights of the whole call come from the set current when it starts
+         std::string references = "\tstd::shared_ptr<const WeightSet> weights = GetWeights();\n";
+         for (auto& name: fWeightOrder){
+            const InitializedTensor& tensor = fInitializedTensors[name];
+            references += "\tconst " + EmittedType(tensor.type) + " (&tensor_" + name + ")[" + std::to_string(ConvertShapeToLength(tensor.shape))
+                          + "] = weights->arena->tensor_" + name + ";\n";
+         }
+         fGC.insert(fInferBodyPosition, references);
+      }
+      if (UseOption(Options::kCalibration)){
+         fGC += "\tCalibration::update();\n";
       }
       if (fOutputTensorNames.size() == 1){
          fGC += "\tstd::vector<float> ret (tensor_" + fOutputTensorNames[0] + ", tensor_" + fOutputTensorNames[0] + " + sizeof(tensor_" +
                fOutputTensorNames[0] + ") / sizeof(tensor_" + fOutputTensorNames[0] + "[0]));\n";
+         if (profile){
+            fGC += "\tif (profile) Profile::record(" + std::to_string(fOperators.size()) + ", profile_tick, Profile::ticks());\n";
+         }
+         if (UseOption(Options::kLatencyHistogram)){
+            fGC += "\tLatency::record(Latency::thread_histogram(), Latency::now() - latency_start);\n";
+         }
          fGC += "\treturn ret;\n";
       }
       fGC += "}\n";
+      if (UseOption(Options::kCalibration)){
+         //infer with the graph inputs in an array, for a driver that does not know their number
+         fGC += "namespace Calibration{\n";
+         fGC += "void run(float* const* inputs){\n\tinfer(";
+         for (std::size_t i = 0; i < fReadyInputTensorInfos.size(); i++){
+            fGC += (i > 0 ? ", inputs[" : "inputs[") + std::to_string(i) + "]";
+         }
+         fGC += ");\n}\n";
+         fGC += "}//Calibration\n";
+      }
       fGC += ("} //TMVA_SOFIE_" + fName + "\n");
+      if (UseOption(Options::kCInterface)){
+         fGC += GenerateCInterface();
+      }
+   }
+
+   std::size_t RModel::GetFlops(){
+      std::size_t flops = 0;
+      for (auto& op: fOperators){
+         flops += op->GetFlops();
+      }
+      return flops;
+   }
+
+   std::vector<OperatorCost> RModel::GetOperatorCosts(){
+      auto bytes = [&](const std::string& name){
+         const TensorEntry* tensor = FindTensor(name);
+         if (tensor == nullptr || tensor->shape == nullptr) return std::size_t(0);
+         return ConvertShapeToLength(*tensor->shape) * GetTypeSize(*tensor->type);
+      };
+      std::vector<OperatorCost> costs(fOperators.size());
+      for (std::size_t id = 0; id < fOperators.size(); id++){
+         OperatorCost& cost = costs[id];
+         cost.name = "op_" + std::to_string(id);
+         cost.op_type = fOperators[id]->GetOpType();
+         cost.flops = fOperators[id]->GetFlops();
+         for (auto& name: fOperators[id]->GetInputTensorNames()){
+            (IsInitializedTensor(name) ? cost.weight_bytes : cost.input_bytes) += bytes(name);
+         }
+         for (auto& name: fOperators[id]->GetOutputTensorNames()){
+            if (cost.output.empty()) cost.output = name;
+            cost.output_bytes += bytes(name);
+         }
+      }
+      return costs;
+   }
+
+   OperatorCost RModel::GetCost(){
+      OperatorCost total;
+      total.name = fName;
+      total.op_type = "Model";
+      if (!fOutputTensorNames.empty()) total.output = fOutputTensorNames[0];
+      for (auto& cost: GetOperatorCosts()){
+         total.flops += cost.flops;
+         total.weight_bytes += cost.weight_bytes;
+         total.input_bytes += cost.input_bytes;
+         total.output_bytes += cost.output_bytes;
+      }
+      return total;
+   }
+
+   MemoryReport RModel::GetMemoryReport(){
+      MemoryReport report;
+      for (auto& i: fInitializedTensors){
+         report.weight_bytes += ConvertShapeToLength(i.second.shape) * GetTypeSize(i.second.type);
+      }
+      std::size_t num_ops = fOperators.size();
+      auto costs = GetOperatorCosts();
+      report.ops.resize(num_ops);
+      for (std::size_t id = 0; id < num_ops; id++){
+         OperatorMemory& op = report.ops[id];
+         op.name = costs[id].name;
+         op.op_type = costs[id].op_type;
+         op.output = costs[id].output;
+         op.scratch_bytes = fOperators[id]->GetScratchBytes();
+         report.scratch_bytes += op.scratch_bytes;
+      }
+      //first writer and last reader of every tensor, in one pass over the operators
+      std::vector<std::size_t> first(fTensors.size(), num_ops), last(fTensors.size(), 0);
+      for (std::size_t id = 0; id < num_ops; id++){
+         for (auto& name: fOperators[id]->GetOutputTensorNames()){
+            auto f = fTensorIds.find(name);
+            if (f != fTensorIds.end() && first[f->second] == num_ops) first[f->second] = id;
+         }
+         for (auto& name: fOperators[id]->GetInputTensorNames()){
+            auto f = fTensorIds.find(name);
+            if (f != fTensorIds.end()) last[f->second] = id;
+         }
+      }
+      for (auto& name: fOutputTensorNames){
+         auto f = fTensorIds.find(name);
+         if (f != fTensorIds.end() && num_ops > 0) last[f->second] = num_ops - 1;
+      }
+      //an intermediate tensor is live from its writer to its last reader, the model output to the end and a tensor no
+      //operator names over the whole inference; the live bytes change by the sizes of the ranges starting and ending
+      std::vector<std::size_t> starting(num_ops + 1, 0), ending(num_ops + 1, 0);
+      for (auto& i: fIntermediateTensorInfos){
+         //only the float tensors are emitted
+         if (i.second.type != ETensorType::FLOAT) continue;
+         std::size_t bytes = ConvertShapeToLength(i.second.shape) * sizeof(float);
+         report.intermediate_bytes += bytes;
+         if (num_ops == 0) continue;
+         TensorId tensor = fTensorIds[i.first];
+         std::size_t begin = first[tensor] < num_ops ? first[tensor] : 0;
+         std::size_t end = first[tensor] < num_ops ? std::max(begin, last[tensor]) : num_ops - 1;
+         starting[begin] += bytes;
+         ending[end + 1] += bytes;
+      }
+      std::vector<std::size_t> live(num_ops, 0);
+      for (std::size_t id = 0, bytes = 0; id < num_ops; id++){
+         bytes += starting[id];
+         bytes -= ending[id];
+         live[id] = bytes;
+      }
+      std::size_t declared_scratch = 0;
+      for (std::size_t id = 0; id < num_ops; id++){
+         OperatorMemory& op = report.ops[id];
+         declared_scratch += op.scratch_bytes;
+         op.static_bytes = report.intermediate_bytes + declared_scratch;
+         op.live_bytes = live[id] + op.scratch_bytes;
+         report.static_peak_bytes = std::max(report.static_peak_bytes, op.static_bytes);
+         report.live_peak_bytes = std::max(report.live_peak_bytes, op.live_bytes);
+      }
+      return report;
+   }
+
+   std::string RModel::GenerateProfiler(){
+      std::string code = "namespace Profile{\n";
+      code += "//time stamp counter where there is one, read without serializing to keep the timers cheap\n"
+              "inline std::uint64_t ticks(){\n"
+              "#if defined(TMVA_SOFIE_RDTSC)\n"
+              "\treturn __rdtsc();\n"
+              "#elif defined(__aarch64__)\n"
+              "\tstd::uint64_t t;\n"
+              "\t__asm__ __volatile__(\"mrs %0, cntvct_el0\" : \"=r\"(t));\n"
+              "\treturn t;\n"
+              "#else\n"
+              "\treturn std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();\n"
+              "#endif\n"
+              "}\n";
+      //the operators in execution order, then the whole infer call
+      code += "//bucket b of the histogram counts the calls of [2^b, 2^(b+1)) ticks\n";
+      code += "const std::size_t max_counters = 8;\n";
+      code += "struct Op { const char* name; const char* type; const char* output; std::uint64_t count; std::uint64_t ticks;"
+              " std::uint64_t min; std::uint64_t max; std::uint64_t histogram[64]; std::uint64_t counters[max_counters];"
+              " std::uint64_t counter_start[max_counters]; };\n";
+      code += "Op ops[] = {\n";
+      for (auto& cost: GetOperatorCosts()){
+         code += "\t{\"" + cost.name + "\", \"" + cost.op_type + "\", \"" + cost.output + "\", 0, 0, ~std::uint64_t(0), 0, {}},\n";
+      }
+      code += "\t{\"infer\", \"infer\", \"" + fOutputTensorNames[0] + "\", 0, 0, ~std::uint64_t(0), 0, {}},\n";
+      code += "};\n";
+      code += "struct Event { std::uint32_t op; std::uint64_t start; std::uint64_t end; };\n"
+              "std::vector<Event> events;\n"
+              "std::size_t max_events = 65536;\n"
+              "std::uint64_t every = 1;\n"
+              "std::uint64_t calls = 0;\n"
+              "bool started = false;\n"
+              "std::uint64_t start_ticks = 0;\n"
+              "std::chrono::steady_clock::time_point start_time;\n"
+              "void (*read_counters)(void* context, std::uint64_t* values) = nullptr;\n"
+              "void* counter_context = nullptr;\n"
+              "const char* const* counter_names = nullptr;\n"
+              "std::size_t num_counters = 0;\n";
+      code += "//profiles one infer call in n, 0 stops profiling\n"
+              "inline void set_sampling(std::uint64_t n){\n"
+              "\tevery = n;\n"
+              "}\n"
+              "//reader of n running counters (at most max_counters, e.g. RPerfCounters::Read), called outside of the timers\n"
+              "//around every profiled operator, the differences are summed per operator. nullptr stops reading them\n"
+              "inline void set_counters(void (*read)(void*, std::uint64_t*), void* context, const char* const* names, std::size_t n){\n"
+              "\tread_counters = read;\n"
+              "\tcounter_context = context;\n"
+              "\tcounter_names = names;\n"
+              "\tnum_counters = read != nullptr ? std::min(n, max_counters) : 0;\n"
+              "}\n"
+              "//events kept for the trace, the aggregates go on once it is full\n"
+              "inline void set_trace_capacity(std::size_t n){\n"
+              "\tmax_events = n;\n"
+              "\tevents.reserve(n);\n"
+              "}\n"
+              "inline bool begin(){\n"
+              "\tstd::uint64_t call = calls++;\n"
+              "\tif (every == 0 || call % every != 0) return false;\n"
+              "\tif (!started){\n"
+              "\t\tevents.reserve(max_events);\n"
+              "\t\tstart_time = std::chrono::steady_clock::now();\n"
+              "\t\tstart_ticks = ticks();\n"
+              "\t\tstarted = true;\n"
+              "\t}\n"
+              "\treturn true;\n"
+              "}\n"
+              "inline std::uint64_t start(std::uint32_t id){\n"
+              "\tif (read_counters != nullptr) read_counters(counter_context, ops[id].counter_start);\n"
+              "\treturn ticks();\n"
+              "}\n"
+              "inline void record(std::uint32_t id, std::uint64_t start, std::uint64_t end){\n"
+              "\tOp& op = ops[id];\n"
+              "\tif (read_counters != nullptr){\n"
+              "\t\tstd::uint64_t values[max_counters];\n"
+              "\t\tread_counters(counter_context, values);\n"
+              "\t\tfor (std::size_t i = 0; i < num_counters; i++) op.counters[i] += values[i] - op.counter_start[i];\n"
+              "\t}\n"
+              "\tstd::uint64_t duration = end - start;\n"
+              "\top.count++;\n"
+              "\top.ticks += duration;\n"
+              "\top.min = std::min(op.min, duration);\n"
+              "\top.max = std::max(op.max, duration);\n"
+              "\tint bucket = 0;\n"
+              "\twhile (duration >>= 1) bucket++;\n"
+              "\top.histogram[bucket]++;\n"
+              "\tif (events.size() < max_events) events.push_back({id, start, end});\n"
+              "}\n"
+              "inline void reset(){\n"
+              "\tfor (auto& op: ops){\n"
+              "\t\top.count = 0;\n"
+              "\t\top.ticks = 0;\n"
+              "\t\top.min = ~std::uint64_t(0);\n"
+              "\t\top.max = 0;\n"
+              "\t\tstd::fill(op.histogram, op.histogram + 64, std::uint64_t(0));\n"
+              "\t\tstd::fill(op.counters, op.counters + max_counters, std::uint64_t(0));\n"
+              "\t}\n"
+              "\tevents.clear();\n"
+              "\tcalls = 0;\n"
+              "\tstarted = false;\n"
+              "}\n";
+      code += "//nanoseconds per tick, measured against the steady clock since the first profiled call\n"
+              "inline double ns_per_tick(){\n"
+              "\tif (!started) return 1.;\n"
+              "\tstd::uint64_t elapsed = ticks() - start_ticks;\n"
+              "\tdouble ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start_time).count();\n"
+              "\treturn elapsed > 0 ? ns / elapsed : 1.;\n"
+              "}\n"
+              "//q quantile in ticks of the calls of an operator, interpolated within its histogram bucket\n"
+              "inline double quantile(const Op& op, double q){\n"
+              "\tstd::uint64_t rank = static_cast<std::uint64_t>(q * op.count), seen = 0;\n"
+              "\tfor (int b = 0; b < 64; b++){\n"
+              "\t\tif (seen + op.histogram[b] > rank){\n"
+              "\t\t\tdouble low = std::max<double>(op.min, b > 0 ? std::ldexp(1., b) : 0.);\n"
+              "\t\t\tdouble high = std::min<double>(op.max, std::ldexp(1., b + 1));\n"
+              "\t\t\treturn low + (high - low) * (rank - seen + 0.5) / op.histogram[b];\n"
+              "\t\t}\n"
+              "\t\tseen += op.histogram[b];\n"
+              "\t}\n"
+              "\treturn op.max;\n"
+              "}\n";
+      code += "//one line per profiled operator, times in microseconds, share of the time of infer, counters per call\n"
+              "inline void write_summary(std::ostream& out = std::cout){\n"
+              "\tdouble us = ns_per_tick() / 1000.;\n"
+              "\tconst Op& total = ops[" + std::to_string(fOperators.size()) + "];\n"
+              "\tout << \"op type output calls total_us mean_us min_us p50_us p99_us max_us share\";\n"
+              "\tfor (std::size_t i = 0; i < num_counters; i++) out << \" \" << counter_names[i];\n"
+              "\tout << \"\\n\";\n"
+              "\tfor (auto& op: ops){\n"
+              "\t\tif (op.count == 0) continue;\n"
+              "\t\tout << op.name << \" \" << op.type << \" \" << op.output << \" \" << op.count << \" \" << op.ticks * us << \" \" << op.ticks * us / op.count\n"
+              "\t\t    << \" \" << op.min * us << \" \" << quantile(op, 0.5) * us << \" \" << quantile(op, 0.99) * us << \" \" << op.max * us\n"
+              "\t\t    << \" \" << (total.ticks > 0 ? 100. * op.ticks / total.ticks : 0.) << \"%\";\n"
+              "\t\tfor (std::size_t i = 0; i < num_counters; i++) out << \" \" << static_cast<double>(op.counters[i]) / op.count;\n"
+              "\t\tout << \"\\n\";\n"
+              "\t}\n"
+              "}\n";
+      code += "//Chrome trace event timeline of the recorded calls, for chrome://tracing or Perfetto\n"
+              "inline void write_trace(std::string filename){\n"
+              "\tstd::ofstream f(filename);\n"
+              "\tif (!f) throw std::runtime_error(\"TMVA SOFIE failed to open trace file \" + filename);\n"
+              "\tdouble us = ns_per_tick() / 1000.;\n"
+              "\tf << std::fixed;\n"
+              "\tf.precision(3);\n"
+              "\tf << \"{\\\"displayTimeUnit\\\":\\\"ns\\\",\\\"traceEvents\\\":[\\n\";\n"
+              "\tf << \"{\\\"name\\\":\\\"process_name\\\",\\\"ph\\\":\\\"M\\\",\\\"pid\\\":0,\\\"args\\\":{\\\"name\\\":\\\"TMVA_SOFIE_" + fName + "\\\"}}\";\n"
+              "\tfor (auto& e: events){\n"
+              "\t\tconst Op& op = ops[e.op];\n"
+              "\t\tf << \",\\n{\\\"name\\\":\\\"\" << op.type << \"\\\",\\\"cat\\\":\\\"sofie\\\",\\\"ph\\\":\\\"X\\\",\\\"pid\\\":0,\\\"tid\\\":0\"\n"
+              "\t\t  << \",\\\"ts\\\":\" << (e.start - start_ticks) * us << \",\\\"dur\\\":\" << (e.end - e.start) * us\n"
+              "\t\t  << \",\\\"args\\\":{\\\"op\\\":\\\"\" << op.name << \"\\\",\\\"output\\\":\\\"\" << op.output << \"\\\"}}\";\n"
+              "\t}\n"
+              "\tf << \"\\n]}\\n\";\n"
+              "}\n";
+      code += "}//Profile\n";
+      return code;
+   }
+
+   std::string RModel::GenerateLatencyHistogram(){
+      std::string code = "namespace Latency{\n";
+      code += "//log-linear buckets as in HdrHistogram: 2^sub_bits linear steps per power of two, a value is known within 1/2^sub_bits\n"
+              "const int sub_bits = 5;\n"
+              "const int num_buckets = (64 - sub_bits + 1) << sub_bits;\n"
+              "//nanoseconds, written by one thread and read by any\n"
+              "struct Histogram{\n"
+              "\tstd::atomic<std::uint64_t> counts[num_buckets];\n"
+              "\tstd::atomic<std::uint64_t> count;\n"
+              "\tstd::atomic<std::uint64_t> sum;\n"
+              "\tstd::atomic<std::uint64_t> max;\n"
+              "\tHistogram* next;\n"
+              "};\n"
+              "inline int bucket(std::uint64_t ns){\n"
+              "\tif (ns < (std::uint64_t(1) << sub_bits)) return static_cast<int>(ns);\n"
+              "#if defined(__GNUC__)\n"
+              "\tint e = 63 - __builtin_clzll(ns);\n"
+              "#else\n"
+              "\tint e = sub_bits;\n"
+              "\twhile (ns >> (e + 1)) e++;\n"
+              "#endif\n"
+              "\treturn ((e - sub_bits + 1) << sub_bits) + static_cast<int>((ns >> (e - sub_bits)) & ((1 << sub_bits) - 1));\n"
+              "}\n"
+              "//smallest and largest value of a bucket\n"
+              "inline std::uint64_t bucket_low(int b){\n"
+              "\tif (b < (1 << sub_bits)) return b;\n"
+              "\treturn std::uint64_t((1 << sub_bits) + (b & ((1 << sub_bits) - 1))) << ((b >> sub_bits) - 1);\n"
+              "}\n"
+              "inline std::uint64_t bucket_high(int b){\n"
+              "\tif (b < (1 << sub_bits)) return b;\n"
+              "\treturn bucket_low(b) + (std::uint64_t(1) << ((b >> sub_bits) - 1)) - 1;\n"
+              "}\n"
+              "//the owner adds without a locked read-modify-write\n"
+              "inline void add(std::atomic<std::uint64_t>& a, std::uint64_t value){\n"
+              "\ta.store(a.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);\n"
+              "}\n"
+              "inline void record(Histogram& h, std::uint64_t ns){\n"
+              "\tadd(h.counts[bucket(ns)], 1);\n"
+              "\tadd(h.count, 1);\n"
+              "\tadd(h.sum, ns);\n"
+              "\tif (ns > h.max.load(std::memory_order_relaxed)) h.max.store(ns, std::memory_order_relaxed);\n"
+              "}\n"
+              "//histograms of the threads that ran infer, never freed so that the calls of finished threads still count\n"
+              "std::atomic<Histogram*> threads{nullptr};\n"
+              "inline Histogram& thread_histogram(){\n"
+              "\tthread_local Histogram* histogram = nullptr;\n"
+              "\tif (histogram == nullptr){\n"
+              "\t\thistogram = new Histogram();\n"
+              "\t\tHistogram* head = threads.load(std::memory_order_relaxed);\n"
+              "\t\tdo {\n"
+              "\t\t\thistogram->next = head;\n"
+              "\t\t} while (!threads.compare_exchange_weak(head, histogram, std::memory_order_release, std::memory_order_relaxed));\n"
+              "\t}\n"
+              "\treturn *histogram;\n"
+              "}\n"
+              "inline std::uint64_t now(){\n"
+              "\treturn std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();\n"
+              "}\n";
+      code += "//histograms merged at one point in time\n"
+              "struct Snapshot{\n"
+              "\tstd::uint64_t counts[num_buckets];\n"
+              "\tstd::uint64_t count;\n"
+              "\tstd::uint64_t sum;\n"
+              "\tstd::uint64_t max;\n"
+              "\tvoid merge(const Histogram& h){\n"
+              "\t\tfor (int b = 0; b < num_buckets; b++) counts[b] += h.counts[b].load(std::memory_order_relaxed);\n"
+              "\t\tcount += h.count.load(std::memory_order_relaxed);\n"
+              "\t\tsum += h.sum.load(std::memory_order_relaxed);\n"
+              "\t\tmax = std::max(max, h.max.load(std::memory_order_relaxed));\n"
+              "\t}\n"
+              "\tvoid merge(const Snapshot& s){\n"
+              "\t\tfor (int b = 0; b < num_buckets; b++) counts[b] += s.counts[b];\n"
+              "\t\tcount += s.count;\n"
+              "\t\tsum += s.sum;\n"
+              "\t\tmax = std::max(max, s.max);\n"
+              "\t}\n"
+              "\t//leaves the calls since an earlier snapshot of the same histograms, max stays that of all the calls\n"
+              "\tvoid subtract(const Snapshot& earlier){\n"
+              "\t\tfor (int b = 0; b < num_buckets; b++) counts[b] -= earlier.counts[b];\n"
+              "\t\tcount -= earlier.count;\n"
+              "\t\tsum -= earlier.sum;\n"
+              "\t}\n"
+              "\tdouble mean() const {\n"
+              "\t\treturn count > 0 ? static_cast<double>(sum) / count : 0.;\n"
+              "\t}\n"
+              "\t//nanoseconds at the q quantile, the middle of its bucket\n"
+              "\tdouble quantile(double q) const {\n"
+              "\t\tstd::uint64_t total = 0;\n"
+              "\t\tfor (int b = 0; b < num_buckets; b++) total += counts[b];\n"
+              "\t\tif (total == 0) return 0.;\n"
+              "\t\tstd::uint64_t rank = std::min(total, std::max<std::uint64_t>(1, static_cast<std::uint64_t>(std::ceil(q * total))));\n"
+              "\t\tstd::uint64_t seen = 0;\n"
+              "\t\tfor (int b = 0; b < num_buckets; b++){\n"
+              "\t\t\tseen += counts[b];\n"
+              "\t\t\tif (seen >= rank) return std::min<double>(max, 0.5 * (bucket_low(b) + bucket_high(b)));\n"
+              "\t\t}\n"
+              "\t\treturn max;\n"
+              "\t}\n"
+              "};\n"
+              "//the calls of infer in the process, merged over the threads\n"
+              "inline Snapshot snapshot(){\n"
+              "\tSnapshot s{};\n"
+              "\tfor (Histogram* h = threads.load(std::memory_order_acquire); h != nullptr; h = h->next) s.merge(*h);\n"
+              "\treturn s;\n"
+              "}\n";
+      code += "}//Latency\n";
+      return code;
+   }
+
+   std::string RModel::GenerateCInterface(){
+      std::string ns = "TMVA_SOFIE_" + fName;
+      std::string code = "//C ABI of SOFIE_plugin.h\n";
+      code += "#ifndef SOFIE_EXPORT\n"
+              "#if defined(_WIN32)\n"
+              "#define SOFIE_EXPORT __declspec(dllexport)\n"
+              "#else\n"
+              "#define SOFIE_EXPORT __attribute__((visibility(\"default\")))\n"
+              "#endif\n"
+              "#endif\n";
+      bool latency = UseOption(Options::kLatencyHistogram);
+      if (latency){
+         //the runs of a session are serialized by run_mutex, so that its histogram has one writer at a time
+         code += "struct sofie_session { std::uint64_t runs; " + ns + "::Latency::Histogram latency; };\n";
+      }else{
+         code += "struct sofie_session { std::uint64_t runs; };\n";
+      }
+
+      //name, ONNX data type, rank and shape of the inputs in the order of the arguments of infer, then of the output
+      code += "namespace " + ns + "{\n";
+      code += "namespace CInterface{\n";
+      code += "struct Tensor { const char* name; int dtype; std::size_t rank; const std::size_t* shape; };\n";
+      auto describe = [&](std::string array, const std::vector<std::pair<std::string, const TensorInfo*>>& tensors){
+         std::string entries;
+         for (std::size_t i = 0; i < tensors.size(); i++){
+            const std::vector<size_t>& shape = tensors[i].second->shape;
+            std::string dims;
+            for (auto& dim: shape) dims += (dims.empty() ? "" : ", ") + std::to_string(dim);
+            code += "const std::size_t " + array + "_shape_" + std::to_string(i) + "[] = {" + (dims.empty() ? "0" : dims) + "};\n";
+            entries += "\t{\"" + tensors[i].first + "\", " + std::to_string(static_cast<int>(tensors[i].second->type)) + ", "
+                       + std::to_string(shape.size()) + ", " + array + "_shape_" + std::to_string(i) + "},\n";
+         }
+         code += "const Tensor " + array + "[] = {\n" + entries + "};\n";
+      };
+      std::vector<std::pair<std::string, const TensorInfo*>> inputs, outputs;
+      for (auto& i: fReadyInputTensorInfos){
+         inputs.emplace_back(i.first, &i.second);
+      }
+      outputs.emplace_back(fOutputTensorNames[0], &fIntermediateTensorInfos[fOutputTensorNames[0]]);
+      describe("inputs", inputs);
+      describe("outputs", outputs);
+      std::size_t intermediate_bytes = 0;
+      for (auto& i: fIntermediateTensorInfos){
+         if (i.second.type == ETensorType::FLOAT) intermediate_bytes += ConvertShapeToLength(i.second.shape) * sizeof(float);
+      }
+      code += "std::mutex run_mutex;   //infer keeps its intermediate tensors in static storage\n";
+      code += "}//CInterface\n";
+      code += "} //" + ns + "\n";
+
+      code += "extern \"C\" {\n";
+      code += "SOFIE_EXPORT int sofie_abi_version(){ return 1; }\n";
+      code += "SOFIE_EXPORT const char* sofie_model_name(){ return \"" + fName + "\"; }\n";
+      code += "SOFIE_EXPORT sofie_session* sofie_create_session(){\n"
+              "\ttry{\n"
+              "\t\treturn new sofie_session{0};\n"
+              "\t}catch (...){\n"
+              "\t\treturn nullptr;\n"
+              "\t}\n"
+              "}\n";
+      code += "SOFIE_EXPORT void sofie_destroy_session(sofie_session* session){ delete session; }\n";
+      for (std::string kind: {"input", "output"}){
+         std::string array = ns + "::CInterface::" + kind + "s";
+         std::string n = std::to_string(kind == "input" ? inputs.size() : outputs.size());
+         code += "SOFIE_EXPORT std::size_t sofie_num_" + kind + "s(){ return " + n + "; }\n";
+         code += "SOFIE_EXPORT const char* sofie_" + kind + "_name(std::size_t index){ return index < " + n + " ? " + array + "[index].name : nullptr; }\n";
+         code += "SOFIE_EXPORT int sofie_" + kind + "_dtype(std::size_t index){ return index < " + n + " ? " + array + "[index].dtype : 0; }\n";
+         code += "SOFIE_EXPORT std::size_t sofie_" + kind + "_rank(std::size_t index){ return index < " + n + " ? " + array + "[index].rank : 0; }\n";
+         code += "SOFIE_EXPORT const std::size_t* sofie_" + kind + "_shape(std::size_t index){ return index < " + n + " ? " + array + "[index].shape : nullptr; }\n";
+      }
+      code += "SOFIE_EXPORT int sofie_run(sofie_session* session, const void* const* inputs, void* const* outputs){\n"
+              "\tif (session == nullptr || inputs == nullptr || outputs == nullptr) return 1;   //SOFIE_ERROR_ARGUMENT\n";
+      if (latency){
+         code += "\tconst std::uint64_t start = " + ns + "::Latency::now();\n";
+      }
+      code += "\ttry{\n"
+              "\t\tstd::lock_guard<std::mutex> lock(" + ns + "::CInterface::run_mutex);\n"
+              "\t\tstd::vector<float> ret = " + ns + "::infer(";
+      for (std::size_t i = 0; i < inputs.size(); i++){
+         code += (i > 0 ? ", " : "") + std::string("static_cast<float*>(const_cast<void*>(inputs[") + std::to_string(i) + "]))";
+      }
+      code += ");\n"
+              "\t\tstd::copy(ret.begin(), ret.end(), static_cast<float*>(outputs[0]));\n"
+              "\t\tsession->runs++;\n";
+      if (latency){
+         code += "\t\t" + ns + "::Latency::record(session->latency, " + ns + "::Latency::now() - start);\n";
+      }
+      code += "\t}catch (...){\n"
+              "\t\treturn 2;   //SOFIE_ERROR_RUNTIME\n"
+              "\t}\n"
+              "\treturn 0;\n"
+              "}\n";
+      code += "SOFIE_EXPORT std::uint64_t sofie_flops(){ return " + std::to_string(GetFlops()) + "ull; }\n";
+      code += "SOFIE_EXPORT std::size_t sofie_weight_bytes(){ return " + std::to_string(fWeightArenaSize) + "; }\n";
+      code += "SOFIE_EXPORT std::size_t sofie_intermediate_bytes(){ return " + std::to_string(intermediate_bytes) + "; }\n";
+      if (latency){
+         code += "SOFIE_EXPORT std::uint64_t sofie_latency_quantiles(const sofie_session* session, const double* quantiles, double* values, std::size_t n){\n"
+                 "\tstatic thread_local " + ns + "::Latency::Snapshot snapshot;\n"
+                 "\tif (session != nullptr){\n"
+                 "\t\tsnapshot = " + ns + "::Latency::Snapshot{};\n"
+                 "\t\tsnapshot.merge(session->latency);\n"
+                 "\t}else{\n"
+                 "\t\tsnapshot = " + ns + "::Latency::snapshot();\n"
+                 "\t}\n"
+                 "\tfor (std::size_t i = 0; i < n; i++) values[i] = snapshot.quantile(quantiles[i]);\n"
+                 "\treturn snapshot.count;\n"
+                 "}\n";
+      }
+      code += "}\n";
+      return code;
    }
 
 
@@ -310,6 +1238,47 @@ namespace SOFIE{
       }
    }
 
+   void RModel::PrintWeightConversionReport(){
+      std::cout << "Model stores the following weights in reduced precision:\n";
+      for (auto& it: fWeightConversions){
+         std::cout << "Tensor name: \"" << it.first << "\"\t";
+         std::cout << "type: " << ConvertTypeToString(it.second.type) << "\t";
+         std::cout << "length: " << it.second.length << "\t";
+         std::cout << "max abs error: " << it.second.max_abs_error << "\t";
+         std::cout << "rms error: " << it.second.rms_error << "\t";
+         std::cout << "relative rms error: " << (it.second.rms > 0 ? it.second.rms_error / it.second.rms : 0.) << std::endl;
+      }
+      if (!fOutputAccuracy.empty()) std::cout << "Outputs against the float reference:\n";
+      for (auto& it: fOutputAccuracy){
+         std::cout << "Output name: \"" << it.first << "\"\t";
+         std::cout << "samples: " << it.second.samples << "\t";
+         std::cout << "max abs error: " << it.second.max_abs_error << "\t";
+         std::cout << "rms error: " << it.second.rms_error << "\t";
+         std::cout << "relative rms error: " << (it.second.rms > 0 ? it.second.rms_error / it.second.rms : 0.) << std::endl;
+      }
+   }
+
+   void RModel::PrintMemoryReport(){
+      MemoryReport report = GetMemoryReport();
+      std::cout << "Model " << fName << " uses the following memory per inference:\n";
+      std::cout << "weights: " << report.weight_bytes << " bytes\t";
+      std::cout << "intermediate tensors: " << report.intermediate_bytes << " bytes\t";
+      std::cout << "scratch: " << report.scratch_bytes << " bytes" << std::endl;
+      for (auto& op: report.ops){
+         std::cout << "Operator: " << op.name << " " << op.op_type << " -> \"" << op.output << "\"\t";
+         std::cout << "scratch: " << op.scratch_bytes << "\t";
+         std::cout << "in use as generated: " << op.static_bytes << "\t";
+         std::cout << "live: " << op.live_bytes << std::endl;
+      }
+      std::cout << "peak as generated: " << report.static_peak_bytes << " bytes\t";
+      std::cout << "peak with planned intermediates: " << report.live_peak_bytes << " bytes" << std::endl;
+      //the default stack of the main thread on Linux, other threads often get less
+      const std::size_t stack_size = 8 << 20;
+      if (report.scratch_bytes > stack_size){
+         std::cout << "Warning: the scratch of infer exceeds the 8 MB default stack size" << std::endl;
+      }
+   }
+
    void RModel::HeadInitializedTensors(std::string name, int n_print){
       auto it = fInitializedTensors.find(name);
       if (it == fInitializedTensors.end()){
@@ -336,7 +1305,7 @@ namespace SOFIE{
       std::cout << "data: [" << std::endl;
       switch(it->second.type){
          case ETensorType::FLOAT : {
-            auto converted_data = std::static_pointer_cast<float>(it->second.data).get();
+            auto converted_data = static_cast<const float*>(GetInitializedTensorData(it->first).get());
             for (int i =0; i < n_print; i++){
                std::cout << converted_data[i];
                if (i < n_print - 1) std::cout << " ,";
@@ -354,12 +1323,280 @@ namespace SOFIE{
          filename = fName + ".hxx";
       }
       std::ofstream f;
-      f.open(filename);
+      std::vector<char> buffer(1 << 20);
+      f.rdbuf()->pubsetbuf(buffer.data(), buffer.size());
+      f.open(filename, std::ios::out | std::ios::binary);
       if (!f.is_open()){
          throw std::runtime_error("tmva-sofie failed to open file for output generated inference code");
       }
-      f << fGC;
+      WriteGenerated(f);
       f.close();
+      if (UseOption(Options::kBinaryWeights)){
+         WeightList symbols;
+         for (auto& name: fWeightOrder){
+            symbols.emplace_back("TMVA_SOFIE_" + fName + "_tensor_" + name, &fInitializedTensors[name]);
+         }
+         WriteWeightBlob(filename, "model " + fName, symbols, fOptions);
+      }
+   }
+
+   void RModel::AppendUsedTensors(const std::string& code, std::vector<char>& seen, std::vector<std::string>& order){
+      const std::string prefix = "tensor_";
+      for (std::size_t pos = code.find(prefix); pos != std::string::npos; pos = code.find(prefix, pos)){
+         bool identifier_start = pos == 0 || !(std::isalnum(static_cast<unsigned char>(code[pos - 1])) || code[pos - 1] == '_');
+         pos += prefix.size();
+         std::size_t end = pos;
+         while (end < code.size() && (std::isalnum(static_cast<unsigned char>(code[end])) || code[end] == '_')) end++;
+         if (identifier_start){
+            auto f = fTensorIds.find(code.substr(pos, end - pos));
+            if (f != fTensorIds.end() && !seen[f->second] && fTensors[f->second].kind == ETensorKind::kInitialized
+                && !EmittedType(*fTensors[f->second].type).empty()){
+               seen[f->second] = true;
+               order.push_back(f->first);
+            }
+         }
+         pos = end;
+      }
+   }
+
+   void RModel::LayoutWeightArena(std::vector<std::string> order){
+      //tensors no operator refers to go last, in name order
+      std::vector<char> placed(fTensors.size(), false);
+      for (auto& name: order) placed[fTensorIds[name]] = true;
+      std::vector<std::string> unused;
+      for (auto& i: fInitializedTensors){
+         if (!EmittedType(i.second.type).empty() && !placed[fTensorIds[i.first]]) unused.push_back(i.first);
+      }
+      std::sort(unused.begin(), unused.end());
+      order.insert(order.end(), unused.begin(), unused.end());
+
+      //every tensor starts on a cache line, which is also the widest SIMD load
+      const std::size_t alignment = 64;
+      std::size_t size = 0;
+      for (auto& name: order){
+         const InitializedTensor& tensor = fInitializedTensors[name];
+         std::size_t bytes = ConvertShapeToLength(tensor.shape) * GetTypeSize(tensor.type);
+         size += (bytes + alignment - 1) / alignment * alignment;
+      }
+      fWeightOrder = std::move(order);
+      fWeightArenaSize = size;
+   }
+
+   void RModel::WriteWeightBlob(std::string filename, std::string title, const WeightList& symbols, std::underlying_type_t<Options> options){
+      std::string blobname = FileStem(filename) + ".bin";
+      std::string stubname = FileStem(filename) + "_weights.S";
+      //raw tensor data, each tensor on a 64 byte boundary as in the weight arena, in the byte order of the generating machine
+      std::ofstream blob(blobname, std::ios::out | std::ios::binary);
+      if (!blob.is_open()){
+         throw std::runtime_error("tmva-sofie failed to open file " + blobname + " for output weights");
+      }
+      std::string stub = "/* weights of " + title + " generated by TMVA SOFIE, assemble with the C compiler"
+                         " from the directory of " + FileBasename(blobname) + " (or with -Wa,-I<dir>) */\n"
+                         "#if defined(__APPLE__)\n"
+                         "#define SOFIE_SYMBOL(name) _##name\n"
+                         "\t.section __TEXT,__const\n"
+                         "#else\n"
+                         "#define SOFIE_SYMBOL(name) name\n";
+      if (options & static_cast<std::underlying_type_t<Options>>(Options::kHugePageWeights)){
+         //same section as the weights of header-embedded models, starting on a huge page
+         stub += "\t.section sofie_weights,\"a\"\n"
+                 "\t.balign 2097152\n";
+      }else{
+         stub += "\t.section .rodata\n";
+      }
+      stub += "#endif\n";
+      const std::size_t alignment = 64;
+      const char padding[alignment] = {};
+      std::size_t offset = 0;
+      for (auto& symbol: symbols){
+         const InitializedTensor& tensor = *symbol.second;
+         std::size_t size = ConvertShapeToLength(tensor.shape) * GetTypeSize(tensor.type);
+         blob.write(static_cast<const char*>(tensor.data.get()), size);
+         std::string name = "SOFIE_SYMBOL(" + symbol.first + ")";
+         stub += "\t.balign " + std::to_string(alignment) + "\n"
+                 "\t.globl " + name + "\n" +
+                 name + ":\n"
+                 "\t.incbin \"" + FileBasename(blobname) + "\", " + std::to_string(offset) + ", " + std::to_string(size) + "\n";
+         std::size_t padded = (size + alignment - 1) / alignment * alignment;
+         blob.write(padding, padded - size);
+         offset += padded;
+      }
+      stub += "#if defined(__ELF__)\n"
+              "\t.section .note.GNU-stack,\"\",%progbits\n"
+              "#endif\n";
+      blob.close();
+      if (!blob){
+         throw std::runtime_error("tmva-sofie failed to write weights to " + blobname);
+      }
+      std::ofstream f(stubname);
+      if (!f.is_open()){
+         throw std::runtime_error("tmva-sofie failed to open file " + stubname + " for output weights");
+      }
+      f << stub;
+   }
+
+   void RModel::WriteGenerated(std::ostream& out){
+      out.write(fGC.data(), fInitializedTensorsPosition);
+      WriteInitializedTensors(out);
+      out.write(fGC.data() + fInitializedTensorsPosition, fGC.size() - fInitializedTensorsPosition);
+   }
+
+   std::string RModel::GetWeightReference(std::string tensor_name, const InitializedTensor& tensor, std::string definition){
+      return "static const " + EmittedType(tensor.type) + " (&tensor_" + tensor_name + ")[" + std::to_string(ConvertShapeToLength(tensor.shape))
+             + "] = " + definition + ";\n";
+   }
+
+   std::string RModel::GetExternalWeightDeclaration(std::string symbol, const InitializedTensor& tensor){
+      return "extern \"C\" const " + EmittedType(tensor.type) + " " + symbol + "[" + std::to_string(ConvertShapeToLength(tensor.shape)) + "];\n";
+   }
+
+   void RModel::WriteInitializedTensors(std::ostream& out){
+      bool swappable = UseOption(Options::kSwappableWeights);
+      WeightList members;
+      members.reserve(fWeightOrder.size());
+      for (auto& name: fWeightOrder){
+         members.emplace_back("tensor_" + name, &fInitializedTensors[name]);
+      }
+      if (UseOption(Options::kBinaryWeights)){
+         //the data is linked in from the blob, see WriteWeightBlob
+         for (auto& name: fWeightOrder){
+            std::string symbol = "TMVA_SOFIE_" + fName + "_tensor_" + name;
+            const InitializedTensor& tensor = fInitializedTensors[name];
+            out << GetExternalWeightDeclaration(symbol, tensor);
+            if (!swappable) out << GetWeightReference(name, tensor, symbol);
+         }
+         if (!swappable) return;
+         //the blob has the layout of the arena and starts with its first tensor
+         out << GetWeightArenaType(members);
+         out << "static const WeightArena& weight_arena = ";
+         if (fWeightOrder.empty()){
+            out << "WeightArena{};\n";
+         }else{
+            out << "*reinterpret_cast<const WeightArena*>(TMVA_SOFIE_" << fName << "_tensor_" << fWeightOrder[0] << ");\n";
+         }
+      }else{
+         WriteWeightArena(out, members, fOptions);
+      }
+      if (!swappable){
+         for (std::size_t i = 0; i < fWeightOrder.size(); i++){
+            out << GetWeightReference(fWeightOrder[i], *members[i].second, "weight_arena." + members[i].first);
+         }
+         return;
+      }
+
+      //read-copy-update: a new set is published with one atomic store, the calls running on the previous one keep it alive
+      out << "struct WeightSet{\n"
+             "\tstd::uint64_t version;\n"
+             "\tconst WeightArena* arena;\n"
+             "\tstd::shared_ptr<const void> storage;   //owns the memory of arena, empty for the weights compiled in\n"
+             "};\n"
+             "static std::atomic<std::uint64_t> weight_version{0};\n"
+             "static std::shared_ptr<const WeightSet> weight_set = std::make_shared<const WeightSet>(WeightSet{0, &weight_arena, nullptr});\n"
+             "inline std::shared_ptr<const WeightSet> GetWeights(){\n"
+             "\treturn std::atomic_load(&weight_set);\n"
+             "}\n"
+             "//publishes arena, kept alive by storage, and returns its version: the next calls of infer read it\n"
+             "inline std::uint64_t SetWeights(const WeightArena* arena, std::shared_ptr<const void> storage){\n"
+             "\tstd::shared_ptr<const WeightSet> set = std::make_shared<const WeightSet>(WeightSet{++weight_version, arena, std::move(storage)});\n"
+             "\tstd::atomic_store(&weight_set, set);\n"
+             "\treturn set->version;\n"
+             "}\n"
+             "//reads the weights written by RModel::OutputWeights (or the .bin of Options::kBinaryWeights) and publishes them\n"
+             "inline std::uint64_t LoadWeights(std::string filename){\n"
+             "\tstd::ifstream f(filename, std::ios::in | std::ios::binary | std::ios::ate);\n"
+             "\tif (!f.is_open()){\n"
+             "\t\tthrow std::runtime_error(\"TMVA SOFIE failed to open weights \" + filename);\n"
+             "\t}\n"
+             "\tif (static_cast<std::size_t>(f.tellg()) != sizeof(WeightArena)){\n"
+             "\t\tthrow std::runtime_error(\"TMVA SOFIE weights \" + filename + \" do not have the layout of model " << fName << "\");\n"
+             "\t}\n"
+             "\tf.seekg(0);\n"
+             "\tstd::shared_ptr<void> storage(std::malloc(sizeof(WeightArena) + 64), std::free);\n"
+             "\tif (!storage) throw std::bad_alloc();\n"
+             "\tvoid* aligned = static_cast<char*>(storage.get()) + (64 - reinterpret_cast<std::uintptr_t>(storage.get()) % 64) % 64;\n"
+             "\tWeightArena* arena = new (aligned) WeightArena;\n"
+             "\tf.read(reinterpret_cast<char*>(arena), sizeof(WeightArena));\n"
+             "\tif (!f){\n"
+             "\t\tthrow std::runtime_error(\"TMVA SOFIE failed to read weights \" + filename);\n"
+             "\t}\n"
+             "\treturn SetWeights(arena, std::move(storage));\n"
+             "}\n";
+   }
+
+   void RModel::OutputWeights(std::string filename){
+      if (fGC.empty()){
+         throw std::runtime_error("TMVA SOFIE model " + fName + " has to be generated before its weights are written out");
+      }
+      std::ofstream f(filename, std::ios::out | std::ios::binary);
+      if (!f.is_open()){
+         throw std::runtime_error("tmva-sofie failed to open file " + filename + " for output weights");
+      }
+      //streamed tensor by tensor with the padding of the arena, as WriteWeightBlob does
+      const std::size_t alignment = 64;
+      const char padding[alignment] = {};
+      for (auto& name: fWeightOrder){
+         const InitializedTensor& tensor = fInitializedTensors[name];
+         std::size_t size = ConvertShapeToLength(tensor.shape) * GetTypeSize(tensor.type);
+         f.write(static_cast<const char*>(tensor.data.get()), size);
+         f.write(padding, (size + alignment - 1) / alignment * alignment - size);
+      }
+      f.close();
+      if (!f){
+         throw std::runtime_error("tmva-sofie failed to write weights to " + filename);
+      }
+   }
+
+   std::string RModel::GetWeightArenaType(const WeightList& members){
+      //one object laid out as the weight arena: tensors in the given order, each on a cache line
+      std::string type = "struct WeightArena{\n";
+      for (auto& member: members){
+         type += "\talignas(64) " + EmittedType(member.second->type) + " " + member.first + "[" + std::to_string(ConvertShapeToLength(member.second->shape)) + "];\n";
+      }
+      return type + "};\n";
+   }
+
+   void RModel::WriteWeightArena(std::ostream& out, const WeightList& members, std::underlying_type_t<Options> options){
+      out << GetWeightArenaType(members);
+      //read-only: the weights land in .rodata, shared by all the processes mapping the binary
+      bool hugepages = options & static_cast<std::underlying_type_t<Options>>(Options::kHugePageWeights);
+      out << "alignas(64) " << (hugepages ? "TMVA_SOFIE_WEIGHT_SECTION " : "") << "const WeightArena weight_arena = {\n";
+
+      //tensors are cut in chunks formatted in parallel; a window of chunks is written out in order before the next
+      //is formatted, so memory stays bounded by the window and the writing overlaps little with the formatting
+      const std::size_t chunk_length = 1 << 16;
+      std::vector<TensorChunk> chunks;
+      for (auto& member: members){
+         std::size_t length = ConvertShapeToLength(member.second->shape);
+         std::size_t begin = 0;
+         do{
+            std::size_t end = std::min(length, begin + chunk_length);
+            chunks.push_back(TensorChunk{member.second, begin, end, ""});
+            begin = end;
+         }while(begin < length);
+      }
+
+      bool hexfloat = options & static_cast<std::underlying_type_t<Options>>(Options::kHexFloatWeights);
+      std::size_t n_threads = std::max(1u, std::thread::hardware_concurrency());
+      std::size_t window = 4 * n_threads;
+      for (std::size_t first = 0; first < chunks.size(); first += window){
+         std::size_t last = std::min(chunks.size(), first + window);
+         if (n_threads == 1 || last - first == 1){
+            for (std::size_t c = first; c < last; c++) FormatChunk(chunks[c], hexfloat);
+         }else{
+            std::vector<std::thread> workers;
+            for (std::size_t t = 0; t < n_threads; t++){
+               workers.emplace_back([&, t](){
+                  for (std::size_t c = first + t; c < last; c += n_threads) FormatChunk(chunks[c], hexfloat);
+               });
+            }
+            for (auto& w: workers) w.join();
+         }
+         for (std::size_t c = first; c < last; c++){
+            out.write(chunks[c].text.data(), chunks[c].text.size());
+            std::string().swap(chunks[c].text);
+         }
+      }
+      out << "};\n";
    }
 
 }//SOFIE
@@ -14,19 +14,52 @@
 
 #include "SOFIE_common.hxx"
 #include "ROperator.hxx"
+#include "RCompiledModel.hxx"
 
 namespace TMVA{
 namespace Experimental{
 namespace SOFIE{
 
+class RModelBundle;
+class RInterpreter;
+
 class RModel{
 
+   friend class RModelBundle;
+   friend class RInterpreter;
+
+   //weights to emit, as (member or symbol name, tensor)
+   using WeightList = std::vector<std::pair<std::string, const InitializedTensor*>>;
+
 private:
 
    std::unordered_map<std::string, InputTensorInfo> fInputTensorInfos; //graph input only; not including operator input (intermediate tensors)
    std::unordered_map<std::string, TensorInfo> fReadyInputTensorInfos;
    std::unordered_map<std::string, InitializedTensor> fInitializedTensors;
    std::unordered_map<std::string, TensorInfo> fIntermediateTensorInfos;
+
+   enum class ETensorKind { kNone, kInput, kReadyInput, kInitialized, kIntermediate };
+   //interned tensor table: a name is hashed once, then the tensor is reached through its id. The entries point into the
+   //map holding the tensor, whose nodes do not move
+   struct TensorEntry{
+      std::string name;
+      ETensorKind kind = ETensorKind::kNone;
+      const ETensorType* type = nullptr;
+      const std::vector<size_t>* shape = nullptr;   //null for graph inputs with a dimension parameter
+   };
+   std::vector<TensorEntry> fTensors;
+   std::unordered_map<std::string, TensorId> fTensorIds;
+   const TensorEntry* FindTensor(const std::string& name) const;
+   void RegisterTensor(const std::string& name, ETensorKind kind, const ETensorType* type, const std::vector<size_t>* shape);
+   //extern "C" functions of SOFIE_plugin.h, emitted after the model namespace with Options::kCInterface
+   std::string GenerateCInterface();
+   //per operator timers, histograms and trace of the Profile namespace emitted with Options::kProfile
+   std::string GenerateProfiler();
+   //lock free log-linear latency histograms of the Latency namespace emitted with Options::kLatencyHistogram
+   std::string GenerateLatencyHistogram();
+   //appends to order the emitted initialized tensors referenced by code and not yet seen, in order of first appearance
+   void AppendUsedTensors(const std::string& code, std::vector<char>& seen, std::vector<std::string>& order);
+
    std::vector<std::string> fOutputTensorNames;
 
    std::vector<std::unique_ptr<ROperator>> fOperators;
@@ -37,11 +70,25 @@ private:
 
 
    std::string fGC; //generated code
+   std::size_t fModelCodePosition = 0;   //where in fGC the code follows the includes, kernels and BLAS declarations
+   std::size_t fInitializedTensorsPosition = 0; //where in fGC the weights are streamed in when the code is written out
+   std::size_t fInferBodyPosition = 0;          //where in fGC the body of infer starts
+   std::vector<std::string> fWeightOrder;   //emitted initialized tensors in order of first use by the operators
+   std::size_t fWeightArenaSize = 0;        //bytes of the WeightArena they are laid out in, see LayoutWeightArena
    std::set<std::string> fNeededBlasRoutines = {};
 
-   const std::vector<std::string> fAllowedStdLib = {"algorithm"};
+   const std::vector<std::string> fAllowedStdLib = {"algorithm", "atomic", "chrono", "cmath", "cstdint", "cstdlib", "fstream", "iostream", "limits", "memory", "mutex", "new", "stdexcept", "string"};
    std::set<std::string> fNeededStdLib = {"vector"};
 
+   std::underlying_type_t<Options> fOptions = 0;
+   std::unordered_map<std::string, std::pair<float, float>> fActivationRanges; //calibrated [min, max] of activation tensors
+   std::unordered_map<std::string, WeightConversionInfo> fWeightConversions;   //weights stored in a reduced precision type
+   std::unordered_map<std::string, OutputAccuracyInfo> fOutputAccuracy;        //outputs checked by CheckOutputAccuracy
+   float fSparseWeightThreshold = 0.7;   //fraction of zero weights above which Gemm emits a sparse kernel
+   std::set<std::string> fSparseInputLayers;   //weight names of the Gemm layers using the sparse input kernel
+   float fSparseInputDensity = 0.5;      //fraction of non zero inputs up to which the sparse input kernel is used at run time
+   std::unordered_map<std::string, std::size_t> fTensorReaders;   //operators listing each tensor as input, counted by Initialize
+
 
 
 public:
@@ -58,10 +105,22 @@ public:
    RModel(){}
    RModel(std::string name, std::string parsedtime);
 
-   const std::vector<size_t>& GetTensorShape(std::string name);
-   const ETensorType& GetTensorType(std::string name);
+   //expected number of tensors and operators, e.g. from the size of the parsed graph
+   void Reserve(std::size_t n_tensors, std::size_t n_operators);
+   TensorId GetTensorId(const std::string& name);
+   const std::string& GetTensorName(TensorId id) const {
+      return fTensors[id].name;
+   }
+   const std::vector<size_t>& GetTensorShape(const std::string& name);
+   const std::vector<size_t>& GetTensorShape(TensorId id);
+   const ETensorType& GetTensorType(const std::string& name);
+   const ETensorType& GetTensorType(TensorId id);
 
-   bool CheckIfTensorAlreadyExist(std::string tensor_name);
+   bool CheckIfTensorAlreadyExist(const std::string& tensor_name);
+   bool IsInitializedTensor(const std::string& tensor_name);
+   bool IsInitializedTensor(TensorId id) const {
+      return fTensors[id].kind == ETensorKind::kInitialized;
+   }
    void AddInputTensorInfo(std::string input_name, ETensorType type, std::vector<Dim> shape);
    void AddInputTensorInfo(std::string input_name, ETensorType type, std::vector<size_t> shape);
    void AddOperator(std::unique_ptr<ROperator> op, int order_execution = -1);
@@ -79,17 +138,104 @@ public:
       fOutputTensorNames = outputtensornames;
    }
    void UpdateInitializedTensor(std::string tensor_name, ETensorType type, std::vector<std::size_t> shape, std::shared_ptr<void> data);
-   std::shared_ptr<void> GetInitializedTensorData(std::string tensor_name);
+   void RemoveInitializedTensor(std::string tensor_name);
+   //true while an operator other than the one initializing reads tensor_name: a weight shared by several operators must
+   //not be converted in place. An operator storing its converted copy under a name of its own calls ReleaseTensor
+   bool IsReadByOtherOperators(const std::string& tensor_name) const {
+      auto f = fTensorReaders.find(tensor_name);
+      return f != fTensorReaders.end() && f->second > 1;
+   }
+   void ReleaseTensor(const std::string& tensor_name){
+      auto f = fTensorReaders.find(tensor_name);
+      if (f != fTensorReaders.end() && f->second > 0) f->second--;
+   }
+   //data of an initialized tensor to be read as its type. The parser keeps views into the model file, which may be
+   //misaligned: such a tensor is copied to aligned memory here, once
+   std::shared_ptr<void> GetInitializedTensorData(const std::string& tensor_name);
+   //the data as it is, to be read bytewise without a copy, as the writers of the weights do
+   std::shared_ptr<void> GetInitializedTensorBytes(const std::string& tensor_name);
+
 
+   bool UseOption(Options option) const {
+      return fOptions & static_cast<std::underlying_type_t<Options>>(option);
+   }
+   void AddActivationRange(std::string tensor_name, float min, float max);
+   bool GetActivationRange(std::string tensor_name, float& min, float& max);
+   void ReadCalibration(std::string filename);
+   void SetSparseWeightThreshold(float threshold){
+      fSparseWeightThreshold = threshold;
+   }
+   float GetSparseWeightThreshold() const {
+      return fSparseWeightThreshold;
+   }
+   void AddSparseInputLayer(std::string weight_name){
+      fSparseInputLayers.insert(UTILITY::Clean_name(weight_name));
+   }
+   bool IsSparseInputLayer(std::string weight_name) const {
+      return UseOption(Options::kSparseInputs) || fSparseInputLayers.count(weight_name) > 0;
+   }
+   void SetSparseInputDensity(float density){
+      fSparseInputDensity = density;
+   }
+   float GetSparseInputDensity() const {
+      return fSparseInputDensity;
+   }
+   void AddWeightConversionInfo(std::string tensor_name, ETensorType type, const float* original, const float* converted, std::size_t length);
+   //runs compiled, built from this model, and reference, an interpreter of the same model with float weights, on
+   //samples inputs drawn uniformly from [-1, 1) and records the error of the output, printed by PrintWeightConversionReport
+   void CheckOutputAccuracy(RInterpreter& reference, const RCompiledModel& compiled, std::size_t samples = 16, unsigned seed = 1);
+   const std::unordered_map<std::string, OutputAccuracyInfo>& GetOutputAccuracy() const {
+      return fOutputAccuracy;
+   }
 
    void Initialize();
-   void Generate();
+   //floating point operations of one inference, summed over the operators once the model is initialized
+   std::size_t GetFlops();
+   //FLOPs and bytes moved of every operator in execution order once the model is initialized, the weights as stored
+   std::vector<OperatorCost> GetOperatorCosts();
+   //their sum over the model
+   OperatorCost GetCost();
+   //weights, intermediate tensors and operator scratch once the model is initialized, with the memory in use at every
+   //operator as generated and with the intermediate tensors kept only over their live ranges
+   MemoryReport GetMemoryReport();
+   void Generate(std::underlying_type_t<Options> options);
+   void Generate(Options options = Options::kDefault){
+      Generate(static_cast<std::underlying_type_t<Options>>(options));
+   }
+
+   //binary snapshot of the parsed model after shape inference, reloaded without parsing (RModel_Snapshot.cxx)
+   void SaveSnapshot(std::string filename);
+   static RModel LoadSnapshot(std::string filename);
+
+   //builds the generated code into a shared object with the local C++ compiler and loads it (RModel_JIT.cxx).
+   //The library is cached in cache_dir under a hash of the generated code, of the weights of a blob and of the compile
+   //command, so that an unchanged model is loaded again without compiling. blas is linked when the model calls BLAS routines
+   RCompiledModel Compile(std::string cache_dir, std::string command = "c++ -O3 -march=native", std::string blas = "-lblas");
 
    void PrintGenerated(){
-      std::cout << fGC;
+      WriteGenerated(std::cout);
    }
    void PrintIntermediateTensors();
+   void PrintWeightConversionReport();
+   void PrintMemoryReport();
    void OutputGenerated(std::string filename = "");
+   void WriteGenerated(std::ostream& out);
+   void WriteInitializedTensors(std::ostream& out);
+   //raw weights in the layout of the generated WeightArena, to be published with the LoadWeights of a model generated
+   //with Options::kSwappableWeights from the same architecture and options
+   void OutputWeights(std::string filename);
+   //lays the emitted initializers out in the given order of first use by the operators, each on a 64 byte boundary.
+   //Only the order and the size are recorded, the data stays where it is and is padded as it is written out
+   void LayoutWeightArena(std::vector<std::string> order);
+   std::vector<std::string> GetPreambleBlocks();
+   static std::string GetBlasDeclarations(const std::set<std::string>& routines);
+   static std::string GetWeightReference(std::string tensor_name, const InitializedTensor& tensor, std::string definition);
+   static std::string GetExternalWeightDeclaration(std::string symbol, const InitializedTensor& tensor);
+   static std::string GetWeightArenaType(const WeightList& members);
+   static void WriteWeightArena(std::ostream& out, const WeightList& members, std::underlying_type_t<Options> options);
+   //with Options::kBinaryWeights the weights go to a raw blob and an assembler stub embedding it with .incbin,
+   //named after the generated header: X.hxx comes with X.bin and X_weights.S
+   static void WriteWeightBlob(std::string filename, std::string title, const WeightList& symbols, std::underlying_type_t<Options> options);
 
 
 /*
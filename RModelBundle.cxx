@@ -0,0 +1,171 @@
+#include "RModelBundle.hxx"
+
+#include <cstring>
+#include <cstdint>
+#include <unordered_map>
+#include <fstream>
+#include <stdexcept>
+
+namespace TMVA{
+namespace Experimental{
+namespace SOFIE{
+
+namespace{
+//FNV-1a over 64 bit words, only used to find candidates: equal contents are confirmed with memcmp
+std::uint64_t HashWeight(const char* data, std::size_t size, ETensorType type){
+   std::uint64_t hash = 14695981039346656037ull ^ static_cast<std::uint64_t>(type);
+   std::size_t n_words = size / sizeof(std::uint64_t);
+   for (std::size_t i = 0; i < n_words; i++){
+      std::uint64_t word;
+      std::memcpy(&word, data + i * sizeof(word), sizeof(word));
+      hash = (hash ^ word) * 1099511628211ull;
+   }
+   for (std::size_t i = n_words * sizeof(std::uint64_t); i < size; i++){
+      hash = (hash ^ static_cast<unsigned char>(data[i])) * 1099511628211ull;
+   }
+   return (hash ^ size) * 1099511628211ull;
+}
+}//anonymous namespace
+
+void RModelBundle::AddModel(RModel&& model){
+   if (fGenerated){
+      throw std::runtime_error("TMVA SOFIE - cannot add model " + model.fName + " to bundle " + fName + " after Generate");
+   }
+   if (model.fName == fName){
+      throw std::runtime_error("TMVA SOFIE - model " + model.fName + " has the name of its bundle, the generated namespaces would clash");
+   }
+   for (auto& m: fModels){
+      if (m.fName == model.fName){
+         throw std::runtime_error("TMVA SOFIE - model " + model.fName + " is already in bundle " + fName);
+      }
+   }
+   fModels.push_back(std::move(model));
+}
+
+void RModelBundle::Generate(std::underlying_type_t<Options> options){
+   if (fGenerated){
+      throw std::runtime_error("TMVA SOFIE - bundle " + fName + " is already generated");
+   }
+   if (options & static_cast<std::underlying_type_t<Options>>(Options::kCInterface)){
+      //every model would export the same C functions
+      throw std::runtime_error("TMVA SOFIE - bundle " + fName + " cannot export the C interface, generate its models separately");
+   }
+   if (options & static_cast<std::underlying_type_t<Options>>(Options::kSwappableWeights)){
+      //the models read the shared weights directly
+      throw std::runtime_error("TMVA SOFIE - bundle " + fName + " cannot swap weights, generate its models separately");
+   }
+   fOptions = options;
+   std::set<std::string> emitted_blocks;
+   for (auto& model: fModels){
+      model.Generate(options);
+      for (auto& block: model.GetPreambleBlocks()){
+         if (emitted_blocks.insert(block).second) fPreamble.push_back(block);
+      }
+      fNeededBlasRoutines.insert(model.fNeededBlasRoutines.begin(), model.fNeededBlasRoutines.end());
+   }
+   DeduplicateWeights();
+   fGenerated = true;
+}
+
+void RModelBundle::DeduplicateWeights(){
+   //the models are visited in order and each in order of first use, so the shared arena keeps the first model's layout
+   std::unordered_multimap<std::uint64_t, std::size_t> by_hash;
+   for (auto& model: fModels){
+      std::vector<std::size_t> index;
+      for (auto& name: model.fWeightOrder){
+         const InitializedTensor& tensor = model.fInitializedTensors[name];
+         std::size_t size = ConvertShapeToLength(tensor.shape) * GetTypeSize(tensor.type);
+         const char* data = static_cast<const char*>(tensor.data.get());
+         std::uint64_t hash = HashWeight(data, size, tensor.type);
+         fTotalWeightBytes += size;
+
+         std::size_t found = fUniqueWeights.size();
+         auto candidates = by_hash.equal_range(hash);
+         for (auto it = candidates.first; it != candidates.second; ++it){
+            const InitializedTensor& other = *fUniqueWeights[it->second].second;
+            if (other.type == tensor.type && ConvertShapeToLength(other.shape) == ConvertShapeToLength(tensor.shape)
+                && (size == 0 || std::memcmp(other.data.get(), data, size) == 0)){
+               found = it->second;
+               break;
+            }
+         }
+         if (found == fUniqueWeights.size()){
+            fUniqueWeights.emplace_back("weight_" + std::to_string(found), &tensor);
+            by_hash.emplace(hash, found);
+            fUniqueWeightBytes += size;
+         }
+         index.push_back(found);
+      }
+      fWeightIndex.push_back(index);
+   }
+}
+
+void RModelBundle::PrintWeightSharingReport(){
+   std::size_t total = 0;
+   for (auto& index: fWeightIndex) total += index.size();
+   std::cout << "Bundle " << fName << " of " << fModels.size() << " models stores " << fUniqueWeights.size() << " distinct weights out of " << total << "\t";
+   std::cout << "bytes: " << fUniqueWeightBytes << " out of " << fTotalWeightBytes << std::endl;
+}
+
+void RModelBundle::WriteGenerated(std::ostream& out){
+   if (!fGenerated){
+      throw std::runtime_error("TMVA SOFIE - bundle " + fName + " has to be generated before it is written out");
+   }
+   bool binary = fOptions & static_cast<std::underlying_type_t<Options>>(Options::kBinaryWeights);
+   out << "//Code generated automatically by TMVA for Inference of the bundle [" << fName << "] of Model files";
+   for (auto& model: fModels) out << " [" << model.fFileName << "]";
+   out << " \n";
+   for (auto& block: fPreamble) out << block;
+   if (!fNeededBlasRoutines.empty()){
+      out << "namespace TMVA_SOFIE_BLAS{\n" << RModel::GetBlasDeclarations(fNeededBlasRoutines) << "}//TMVA_SOFIE_BLAS\n";
+   }
+
+   out << "namespace TMVA_SOFIE_" << fName << "{\n";
+   if (binary){
+      for (auto& weight: fUniqueWeights){
+         out << RModel::GetExternalWeightDeclaration("TMVA_SOFIE_" + fName + "_" + weight.first, *weight.second);
+      }
+   }else{
+      RModel::WriteWeightArena(out, fUniqueWeights, fOptions);
+   }
+   out << "} //TMVA_SOFIE_" << fName << "\n";
+
+   for (std::size_t m = 0; m < fModels.size(); m++){
+      RModel& model = fModels[m];
+      out << "namespace TMVA_SOFIE_" << model.fName << "{\n";
+      if (!model.fNeededBlasRoutines.empty()) out << "namespace BLAS = ::TMVA_SOFIE_BLAS;\n";
+      out.write(model.fGC.data() + model.fModelCodePosition, model.fInitializedTensorsPosition - model.fModelCodePosition);
+      for (std::size_t i = 0; i < model.fWeightOrder.size(); i++){
+         const std::string& member = fUniqueWeights[fWeightIndex[m][i]].first;
+         std::string definition = "::TMVA_SOFIE_" + fName + "::" + (binary ? "TMVA_SOFIE_" + fName + "_" + member : "weight_arena." + member);
+         out << RModel::GetWeightReference(model.fWeightOrder[i], model.fInitializedTensors[model.fWeightOrder[i]], definition);
+      }
+      out.write(model.fGC.data() + model.fInitializedTensorsPosition, model.fGC.size() - model.fInitializedTensorsPosition);
+   }
+}
+
+void RModelBundle::OutputGenerated(std::string filename){
+   if (filename == ""){
+      filename = fName + ".hxx";
+   }
+   std::ofstream f;
+   std::vector<char> buffer(1 << 20);
+   f.rdbuf()->pubsetbuf(buffer.data(), buffer.size());
+   f.open(filename, std::ios::out | std::ios::binary);
+   if (!f.is_open()){
+      throw std::runtime_error("tmva-sofie failed to open file for output generated inference code");
+   }
+   WriteGenerated(f);
+   f.close();
+   if (fOptions & static_cast<std::underlying_type_t<Options>>(Options::kBinaryWeights)){
+      RModel::WeightList symbols;
+      for (auto& weight: fUniqueWeights){
+         symbols.emplace_back("TMVA_SOFIE_" + fName + "_" + weight.first, weight.second);
+      }
+      RModel::WriteWeightBlob(filename, "bundle " + fName, symbols, fOptions);
+   }
+}
+
+}//SOFIE
+}//Experimental
+}//TMVA
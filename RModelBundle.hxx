@@ -0,0 +1,63 @@
+#ifndef TMVA_SOFIE_RMODELBUNDLE
+#define TMVA_SOFIE_RMODELBUNDLE
+
+#include <vector>
+#include <string>
+#include <iostream>
+
+#include "SOFIE_common.hxx"
+#include "RModel.hxx"
+
+namespace TMVA{
+namespace Experimental{
+namespace SOFIE{
+
+//several models generated into one header: bit-identical weights are stored once in namespace TMVA_SOFIE_<bundle name>,
+//the includes, helper kernels and BLAS declarations are emitted once for all the models
+class RModelBundle{
+
+private:
+
+   std::string fName;
+   std::vector<RModel> fModels;
+   std::underlying_type_t<Options> fOptions = 0;
+
+   std::vector<std::string> fPreamble;           //includes and helper kernels of all the models, each once
+   std::set<std::string> fNeededBlasRoutines;
+   RModel::WeightList fUniqueWeights;            //(arena member name, tensor), one entry per distinct content
+   std::vector<std::vector<std::size_t>> fWeightIndex;   //per model, the unique weight of every entry of its fWeightOrder
+   std::size_t fTotalWeightBytes = 0;
+   std::size_t fUniqueWeightBytes = 0;
+
+   bool fGenerated = false;
+
+   void DeduplicateWeights();
+
+public:
+
+   RModelBundle(std::string name): fName(name) {}
+
+   //disallow copy, the bundle owns the models
+   RModelBundle(const RModelBundle& other) = delete;
+   RModelBundle& operator=(const RModelBundle& other) = delete;
+
+   void AddModel(RModel&& model);
+
+   void Generate(std::underlying_type_t<Options> options);
+   void Generate(Options options = Options::kDefault){
+      Generate(static_cast<std::underlying_type_t<Options>>(options));
+   }
+
+   void PrintGenerated(){
+      WriteGenerated(std::cout);
+   }
+   void PrintWeightSharingReport();
+   void OutputGenerated(std::string filename = "");
+   void WriteGenerated(std::ostream& out);
+};
+
+}//SOFIE
+}//Experimental
+}//TMVA
+
+#endif //TMVA_SOFIE_RMODELBUNDLE
@@ -1,8 +1,9 @@
 #include "RModelParser_ONNX.hxx"
-#include "onnx_proto3.pb.h"
 
 #include <string>
 #include <memory>
+#include <cstring>
+#include <unordered_set>
 
 namespace TMVA{
 namespace Experimental{
@@ -10,7 +11,7 @@ namespace SOFIE{
 
 namespace INTERNAL{
 
-std::unique_ptr<ROperator> make_ROperator(size_t idx, const onnx::GraphProto& graphproto, std::unordered_map<std::string, ETensorType>& tensor_type){
+std::unique_ptr<ROperator> make_ROperator(size_t idx, const ONNX::GraphProto& graphproto, std::unordered_map<std::string, ETensorType>& tensor_type){
    const auto& nodeproto = graphproto.node(idx);
    auto find = mapOptypeOperator.find(nodeproto.op_type());
    if (find == mapOptypeOperator.end()){
@@ -20,7 +21,7 @@ std::unique_ptr<ROperator> make_ROperator(size_t idx, const onnx::GraphProto& gr
    }
 }
 
-std::unique_ptr<ROperator> make_ROperator_Transpose(const onnx::NodeProto& nodeproto, const onnx::GraphProto& graphproto, std::unordered_map<std::string, ETensorType>& tensor_type){
+std::unique_ptr<ROperator> make_ROperator_Transpose(const ONNX::NodeProto& nodeproto, const ONNX::GraphProto& graphproto, std::unordered_map<std::string, ETensorType>& tensor_type){
 
    ETensorType input_type;
 
@@ -61,7 +62,7 @@ std::unique_ptr<ROperator> make_ROperator_Transpose(const onnx::NodeProto& nodep
    return std::move(op);
 }
 
-std::unique_ptr<ROperator> make_ROperator_Relu(const onnx::NodeProto& nodeproto, const onnx::GraphProto& graphproto, std::unordered_map<std::string, ETensorType>& tensor_type){
+std::unique_ptr<ROperator> make_ROperator_Relu(const ONNX::NodeProto& nodeproto, const ONNX::GraphProto& graphproto, std::unordered_map<std::string, ETensorType>& tensor_type){
 
    ETensorType input_type;
 
@@ -93,7 +94,7 @@ std::unique_ptr<ROperator> make_ROperator_Relu(const onnx::NodeProto& nodeproto,
    return std::move(op);
 }
 
-std::unique_ptr<ROperator> make_ROperator_Gemm(const onnx::NodeProto& nodeproto, const onnx::GraphProto& graphproto, std::unordered_map<std::string, ETensorType>& tensor_type){
+std::unique_ptr<ROperator> make_ROperator_Gemm(const ONNX::NodeProto& nodeproto, const ONNX::GraphProto& graphproto, std::unordered_map<std::string, ETensorType>& tensor_type){
 
    ETensorType input_type;
 
@@ -152,7 +153,7 @@ std::unique_ptr<ROperator> make_ROperator_Gemm(const onnx::NodeProto& nodeproto,
    return std::move(op);
 }
 
-std::unique_ptr<ROperator> make_ROperator_Conv(const onnx::NodeProto& nodeproto, const onnx::GraphProto& graphproto, std::unordered_map<std::string, ETensorType>& tensor_type) {
+std::unique_ptr<ROperator> make_ROperator_Conv(const ONNX::NodeProto& nodeproto, const ONNX::GraphProto& graphproto, std::unordered_map<std::string, ETensorType>& tensor_type) {
 
    ETensorType input_type;
 
@@ -215,6 +216,36 @@ std::unique_ptr<ROperator> make_ROperator_Conv(const onnx::NodeProto& nodeproto,
    return std::move(op);
 }
 
+ONNX::Span GetExternalData(const ONNX::TensorProto& tensorproto, const std::string& directory, std::unordered_map<std::string, std::shared_ptr<MappedFile>>& external_files, std::shared_ptr<MappedFile>& file){
+   std::string location;
+   std::size_t offset = 0;
+   std::size_t length = std::string::npos;
+   for (auto& entry: tensorproto.external_data()){
+      if (entry.first == "location"){
+         location = entry.second;
+      }else if (entry.first == "offset"){
+         offset = std::stoull(entry.second);
+      }else if (entry.first == "length"){
+         length = std::stoull(entry.second);
+      }
+   }
+   if (location.empty()){
+      throw std::runtime_error("TMVA::SOFIE - Failed to parse onnx file: external data of tensor " + tensorproto.name() + " has no location");
+   }
+
+   auto it = external_files.find(location);
+   if (it == external_files.end()){
+      it = external_files.emplace(location, std::make_shared<MappedFile>(directory + location)).first;
+   }
+   file = it->second;
+
+   if (offset > file->size() || (length != std::string::npos && length > file->size() - offset)){
+      throw std::runtime_error("TMVA::SOFIE - Failed to parse onnx file: external data of tensor " + tensorproto.name() + " lies outside of " + location);
+   }
+   if (length == std::string::npos) length = file->size() - offset;
+   return ONNX::Span{file->data() + offset, length};
+}
+
 } //INTERNAL
 
 
@@ -224,37 +255,54 @@ RModel RModelParser_ONNX::Parse(std::string filename){
    #ifdef _WIN32
       sep = '\\';
    #endif
+   //the model is named after the file, external data locations are relative to its directory
+   std::string filepath = filename;
+   std::string directory;
    size_t i = filename.rfind(sep, filename.length());
    std::string modelname;
    if (i != std::string::npos){
+      directory = filename.substr(0, i+1);
       filename = (filename.substr(i+1, filename.length() - i));
    }
 
 
 
    std::time_t ttime = std::time(0);
-   std::tm* gmt_time = std::gmtime(&ttime);
-   std::string parsetime (std::asctime(gmt_time));
+   //reentrant variants: Parse may run concurrently on several threads
+   std::tm gmt_time;
+   char time_buffer[32];
+   #ifdef _WIN32
+      gmtime_s(&gmt_time, &ttime);
+      asctime_s(time_buffer, sizeof(time_buffer), &gmt_time);
+   #else
+      gmtime_r(&ttime, &gmt_time);
+      asctime_r(&gmt_time, time_buffer);
+   #endif
+   std::string parsetime (time_buffer);
 
 
 
 
-   GOOGLE_PROTOBUF_VERIFY_VERSION;
    //model I/O
-   onnx::ModelProto model;
+   ONNX::ModelProto model;
    RModel rmodel(filename, parsetime);
 
    std::unordered_map<std::string, ETensorType> tensor_type;
 
-   std::fstream input(filename, std::ios::in | std::ios::binary);
-   if (!model.ParseFromIstream(&input)){
-      throw std::runtime_error("TMVA::SOFIE - Failed to parse onnx file");
-   }
+   model.ParseFromFile(filepath);
 
-   const onnx::GraphProto& graph = model.graph(); //not a memory leak. model freed automatically at the end.
-   google::protobuf::ShutdownProtobufLibrary();
+   const ONNX::GraphProto& graph = model.graph();
+
+   //every tensor is a graph input, an initializer or a node output: size the tables once for huge graphs
+   std::size_t n_tensors = graph.input_size() + graph.initializer_size();
+   for (int i=0; i < graph.node_size(); i++){
+      n_tensors += graph.node(i).output_size();
+   }
+   rmodel.Reserve(n_tensors, graph.node_size());
+   tensor_type.reserve(n_tensors);
 
    std::unordered_set<std::string> initializer_names;
+   initializer_names.reserve(graph.initializer_size());
    for (int i=0; i < graph.initializer_size(); i++){
       initializer_names.insert(graph.initializer(i).name());
    }
@@ -262,35 +310,35 @@ RModel RModelParser_ONNX::Parse(std::string filename){
 
    for (int i=0; i < graph.input_size(); i++){
 
-      tensor_type[graph.input(i).name()] = static_cast<ETensorType>(graph.input(i).type().tensor_type().elem_type());
+      tensor_type[graph.input(i).name()] = static_cast<ETensorType>(graph.input(i).elem_type());
 
       if (initializer_names.find(graph.input(i).name()) != initializer_names.end())  continue;
 
       //input datanode is not a weight node (has no initializer)
-      const onnx::ValueInfoProto& valueinfoproto = graph.input(i);
+      const ONNX::ValueInfoProto& valueinfoproto = graph.input(i);
       std::string input_name = valueinfoproto.name();
-      ETensorType type = static_cast<ETensorType>(valueinfoproto.type().tensor_type().elem_type());
+      ETensorType type = static_cast<ETensorType>(valueinfoproto.elem_type());
       if (type != ETensorType::FLOAT){
          throw std::runtime_error("TMVA::SOFIE Data type in input tensor " + input_name + " not supported!\n");
       }
 
       std::vector<Dim> fShape;
       bool existParam = false;
-      if (!valueinfoproto.type().tensor_type().has_shape()) throw std::runtime_error("TMVA::SOFIE datanode with no shape restrictions is not supported yet");
-      for (int i = 0; i < valueinfoproto.type().tensor_type().shape().dim_size(); i++){
+      if (!valueinfoproto.has_shape()) throw std::runtime_error("TMVA::SOFIE datanode with no shape restrictions is not supported yet");
+      for (int i = 0; i < valueinfoproto.dim_size(); i++){
          Dim dim;
-         if (valueinfoproto.type().tensor_type().shape().dim(i).value_case() == onnx::TensorShapeProto_Dimension::ValueCase::kDimValue){
-            dim.dim = valueinfoproto.type().tensor_type().shape().dim(i).dim_value();
-         }else if (valueinfoproto.type().tensor_type().shape().dim(i).value_case() == onnx::TensorShapeProto_Dimension::ValueCase::kDimParam){
+         if (valueinfoproto.dim(i).value_case == ONNX::ValueInfoProto::Dimension::ValueCase::kDimValue){
+            dim.dim = valueinfoproto.dim(i).dim_value;
+         }else if (valueinfoproto.dim(i).value_case == ONNX::ValueInfoProto::Dimension::ValueCase::kDimParam){
             dim.isParam = true;
             existParam = true;
-            dim.param = valueinfoproto.type().tensor_type().shape().dim(i).dim_param();
+            dim.param = valueinfoproto.dim(i).dim_param;
          }else{
             throw std::runtime_error("TMVA::SOFIE ONNX file error: Valueinfoproto " + input_name + " has neither dim_value nor dim_param! \n");
          }
          fShape.push_back(dim);
       }
-      if (valueinfoproto.type().tensor_type().shape().dim_size() == 0){
+      if (valueinfoproto.dim_size() == 0){
          Dim dim;
          dim.dim = 1;
          fShape.push_back(dim);
@@ -309,8 +357,11 @@ RModel RModelParser_ONNX::Parse(std::string filename){
 
    }
 
+   //external data files, each mapped once however many tensors live in it
+   std::unordered_map<std::string, std::shared_ptr<MappedFile>> external_files;
+
    for (int i=0; i < graph.initializer_size(); i++){
-      onnx::TensorProto* tensorproto = const_cast<onnx::TensorProto*>(&graph.initializer(i));
+      const ONNX::TensorProto* tensorproto = &graph.initializer(i);
       std::vector<std::size_t> fShape;
       std::size_t fLength = 1;
       for (int i = 0; i < tensorproto->dims_size(); i++){
@@ -322,14 +373,26 @@ RModel RModelParser_ONNX::Parse(std::string filename){
 
       switch(static_cast<ETensorType>(graph.initializer(i).data_type())){
          case ETensorType::FLOAT : {
-            //void* data = malloc (fLength * sizeof(float));
-            std::shared_ptr<void> data(malloc(fLength * sizeof(float)), free);
-
-            if (tensorproto->raw_data().empty() == false){
-               auto raw_data_ptr = reinterpret_cast<float*>(const_cast<char*>(tensorproto->raw_data().c_str()));
-               std::memcpy(data.get(), raw_data_ptr, fLength * sizeof(float));
+            //raw_data, packed float_data and external data are little endian floats: hand out a view into the
+            //mapped file that keeps the mapping alive, even a misaligned one (see RModel::GetInitializedTensorData),
+            //copy only the unpacked encoding
+            std::shared_ptr<MappedFile> file = model.file();
+            ONNX::Span bytes = tensorproto->raw_data().size > 0 ? tensorproto->raw_data() : tensorproto->packed_float_data();
+            if (tensorproto->data_location() == ONNX::TensorProto::EXTERNAL){
+               bytes = INTERNAL::GetExternalData(*tensorproto, directory, external_files, file);
+            }
+            std::shared_ptr<void> data;
+            if (bytes.size > 0 || tensorproto->float_data().empty()){
+               if (bytes.size != fLength * sizeof(float)){
+                  throw std::runtime_error("TMVA::SOFIE - Failed to parse onnx file: data of tensor " + input_name + " does not match its shape");
+               }
+               data = std::shared_ptr<void>(file, const_cast<char*>(bytes.data));
             }else{
-               tensorproto->mutable_float_data()->ExtractSubrange(0, tensorproto->float_data_size(), static_cast<float*>(data.get()));
+               if (tensorproto->float_data().size() != fLength){
+                  throw std::runtime_error("TMVA::SOFIE - Failed to parse onnx file: data of tensor " + input_name + " does not match its shape");
+               }
+               data = std::shared_ptr<void>(malloc(fLength * sizeof(float)), free);
+               std::memcpy(data.get(), tensorproto->float_data().data(), fLength * sizeof(float));
             }
 
             rmodel.AddInitializedTensor(input_name, ETensorType::FLOAT, fShape, data);
@@ -6,31 +6,26 @@
 #include "SOFIE_common.hxx"
 #include "RModel.hxx"
 #include "OperatorList.hxx"
+#include "SOFIE_onnx.hxx"
 
 #include <string>
 #include <fstream>
 #include <memory>
 #include <ctime>
 
-//forward delcaration
-namespace onnx{
-   class NodeProto;
-   class GraphProto;
-}
-
 namespace TMVA{
 namespace Experimental{
 namespace SOFIE{
 
 namespace INTERNAL{
 
-std::unique_ptr<ROperator> make_ROperator_Transpose(const onnx::NodeProto& nodeproto, const onnx::GraphProto& graphproto, std::unordered_map<std::string, ETensorType>& tensor_type);
-std::unique_ptr<ROperator> make_ROperator_Relu(const onnx::NodeProto& nodeproto, const onnx::GraphProto& graphproto, std::unordered_map<std::string, ETensorType>& tensor_type);
-std::unique_ptr<ROperator> make_ROperator_Gemm(const onnx::NodeProto& nodeproto, const onnx::GraphProto& graphproto, std::unordered_map<std::string, ETensorType>& tensor_type);
-std::unique_ptr<ROperator> make_ROperator_Conv(const onnx::NodeProto& nodeproto, const onnx::GraphProto& graphproto, std::unordered_map<std::string, ETensorType>& tensor_type);
+std::unique_ptr<ROperator> make_ROperator_Transpose(const ONNX::NodeProto& nodeproto, const ONNX::GraphProto& graphproto, std::unordered_map<std::string, ETensorType>& tensor_type);
+std::unique_ptr<ROperator> make_ROperator_Relu(const ONNX::NodeProto& nodeproto, const ONNX::GraphProto& graphproto, std::unordered_map<std::string, ETensorType>& tensor_type);
+std::unique_ptr<ROperator> make_ROperator_Gemm(const ONNX::NodeProto& nodeproto, const ONNX::GraphProto& graphproto, std::unordered_map<std::string, ETensorType>& tensor_type);
+std::unique_ptr<ROperator> make_ROperator_Conv(const ONNX::NodeProto& nodeproto, const ONNX::GraphProto& graphproto, std::unordered_map<std::string, ETensorType>& tensor_type);
 
 
-using factoryMethodMap = std::unordered_map<std::string, std::unique_ptr<ROperator> (*)(const onnx::NodeProto&, const onnx::GraphProto&, std::unordered_map<std::string, ETensorType>&)>;
+using factoryMethodMap = std::unordered_map<std::string, std::unique_ptr<ROperator> (*)(const ONNX::NodeProto&, const ONNX::GraphProto&, std::unordered_map<std::string, ETensorType>&)>;
 const factoryMethodMap mapOptypeOperator = {
       {"Gemm", &make_ROperator_Gemm},
       {"Transpose", &make_ROperator_Transpose},
@@ -39,7 +34,10 @@ const factoryMethodMap mapOptypeOperator = {
    };
 
 
-std::unique_ptr<ROperator> make_ROperator(size_t idx, const onnx::GraphProto& graphproto, std::unordered_map<std::string, ETensorType>& tensor_type);
+std::unique_ptr<ROperator> make_ROperator(size_t idx, const ONNX::GraphProto& graphproto, std::unordered_map<std::string, ETensorType>& tensor_type);
+
+//bytes of a tensor stored outside the model (data_location EXTERNAL), file is set to the mapping holding them
+ONNX::Span GetExternalData(const ONNX::TensorProto& tensorproto, const std::string& directory, std::unordered_map<std::string, std::shared_ptr<MappedFile>>& external_files, std::shared_ptr<MappedFile>& file);
 }//INTERNAL
 
 
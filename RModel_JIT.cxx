@@ -0,0 +1,295 @@
+#include "RModel.hxx"
+#include "RCompiledModel.hxx"
+#include "RPerfCounters.hxx"
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+#include <stdexcept>
+
+#ifndef _WIN32
+#include <dlfcn.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace TMVA{
+namespace Experimental{
+namespace SOFIE{
+
+#ifndef _WIN32
+
+namespace{
+
+std::uint64_t HashCode(const char* data, std::size_t size, std::uint64_t hash = 14695981039346656037ull){
+   for (std::size_t i = 0; i < size; i++){
+      hash = (hash ^ static_cast<unsigned char>(data[i])) * 1099511628211ull;
+   }
+   return hash;
+}
+
+//the commands run through the shell, paths are single quoted
+std::string Quote(const std::string& path){
+   if (path.find('\'') != std::string::npos){
+      throw std::runtime_error("TMVA SOFIE cannot compile in path " + path + " containing a quote");
+   }
+   return "'" + path + "'";
+}
+
+bool FileExists(const std::string& path){
+   struct stat info;
+   return stat(path.c_str(), &info) == 0;
+}
+
+}//anonymous namespace
+
+RCompiledModel::RCompiledModel(std::string library, std::string symbol, std::vector<std::vector<std::size_t>> input_shapes,
+                               std::size_t output_length, bool from_cache):
+   fInputShapes(input_shapes), fOutputLength(output_length), fLibraryPath(library), fSymbol(symbol), fFromCache(from_cache){
+   void* handle = dlopen(library.c_str(), RTLD_NOW | RTLD_LOCAL);
+   if (handle == nullptr){
+      throw std::runtime_error("TMVA SOFIE failed to load " + library + ": " + dlerror());
+   }
+   fLibrary = std::shared_ptr<void>(handle, [](void* h){ dlclose(h); });
+   fInfer = reinterpret_cast<std::size_t (*)(float* const*, float*)>(dlsym(handle, symbol.c_str()));
+   if (fInfer == nullptr){
+      throw std::runtime_error("TMVA SOFIE library " + library + " has no entry point " + symbol);
+   }
+   //only there with Options::kProfile
+   fProfile = reinterpret_cast<ProfileFunction>(dlsym(handle, (symbol + "_profile").c_str()));
+   fProfileCounters = reinterpret_cast<ProfileCountersFunction>(dlsym(handle, (symbol + "_profile_counters").c_str()));
+   //only there with Options::kLatencyHistogram
+   fLatency = reinterpret_cast<LatencyFunction>(dlsym(handle, (symbol + "_latency").c_str()));
+}
+
+std::vector<float> RCompiledModel::Infer(const std::vector<const float*>& inputs) const {
+   if (inputs.size() != fInputShapes.size()){
+      throw std::runtime_error("TMVA SOFIE compiled model " + fLibraryPath + " expects " + std::to_string(fInputShapes.size())
+                               + " inputs, got " + std::to_string(inputs.size()));
+   }
+   std::vector<float> output(fOutputLength);
+   fInfer(const_cast<float* const*>(inputs.data()), output.data());   //inputs are only read
+   return output;
+}
+
+std::vector<RCompiledModel::ProfileEntry> RCompiledModel::GetProfile(bool reset) const {
+   if (fProfile == nullptr) return {};
+   std::size_t n = fProfile(nullptr, nullptr, nullptr, 0, 0, 0);
+   std::size_t n_counters = fCounters != nullptr ? static_cast<std::size_t>(RPerfCounters::kNumCounters) : 0;
+   std::vector<double> ns(n);
+   std::vector<std::uint64_t> calls(n);
+   std::vector<std::uint64_t> counters(n * n_counters);
+   fProfile(ns.data(), calls.data(), counters.data(), n, n_counters, reset);
+   std::vector<ProfileEntry> profile(n);
+   for (std::size_t i = 0; i < n; i++){
+      profile[i].ns = ns[i];
+      profile[i].calls = calls[i];
+      profile[i].counters.assign(counters.begin() + i * n_counters, counters.begin() + (i + 1) * n_counters);
+   }
+   return profile;
+}
+
+std::vector<double> RCompiledModel::GetLatencyQuantiles(const std::vector<double>& quantiles, std::uint64_t* count) const {
+   std::vector<double> values(quantiles.size(), 0.);
+   std::uint64_t n = fLatency != nullptr ? fLatency(quantiles.data(), values.data(), quantiles.size()) : 0;
+   if (count != nullptr) *count = n;
+   return values;
+}
+
+void RCompiledModel::SetProfileCounters(const RPerfCounters* counters){
+   if (fProfileCounters == nullptr){
+      throw std::runtime_error("TMVA SOFIE compiled model " + fLibraryPath + " is not generated with Options::kProfile");
+   }
+   static const char* names[RPerfCounters::kNumCounters];
+   for (int i = 0; i < RPerfCounters::kNumCounters; i++) names[i] = RPerfCounters::GetName(i);
+   if (counters != nullptr){
+      fProfileCounters(&RPerfCounters::Read, const_cast<RPerfCounters*>(counters), names, RPerfCounters::kNumCounters);
+   }else{
+      fProfileCounters(nullptr, nullptr, nullptr, 0);
+   }
+   fCounters = counters;
+}
+
+std::string RCompiledModel::GetTargetFeatures(const std::string& command){
+   //the macros the kernels of SOFIE_kernels.cxx are selected by
+   static const char* macros[][2] = {{"__AVX2__", "avx2"}, {"__FMA__", "fma"}, {"__F16C__", "f16c"},
+                                     {"__AVX512VL__", "avx512vl"}, {"__AVX512VNNI__", "avx512vnni"}, {"__AVXVNNI__", "avxvnni"}};
+   FILE* pipe = popen((command + " -dM -E -x c++ - < /dev/null 2> /dev/null").c_str(), "r");
+   if (pipe == nullptr) return "";
+   std::string defines;
+   char buffer[4096];
+   for (std::size_t n; (n = std::fread(buffer, 1, sizeof(buffer), pipe)) > 0;) defines.append(buffer, n);
+   if (pclose(pipe) != 0) return "";
+   std::string features;
+   for (auto& macro: macros){
+      if (defines.find(std::string("#define ") + macro[0] + " ") == std::string::npos) continue;
+      features += (features.empty() ? "" : " ") + std::string(macro[1]);
+   }
+   return features.empty() ? "scalar" : features;
+}
+
+RCompiledModel RModel::Compile(std::string cache_dir, std::string command, std::string blas){
+   if (fGC.empty()){
+      throw std::runtime_error("TMVA SOFIE model " + fName + " has to be generated before it is compiled");
+   }
+   std::ostringstream header;
+   WriteGenerated(header);
+   std::string code = header.str();
+
+   //the first line carries the parse time, everything else that ends up in the library is part of the key
+   std::size_t first_line = code.find('\n') + 1;
+   std::string settings = "\n" + command + "\n" + blas + "\n" + std::to_string(fOptions);
+   std::uint64_t hash = HashCode(code.data() + first_line, code.size() - first_line);
+   hash = HashCode(settings.data(), settings.size(), hash);
+   if (UseOption(Options::kBinaryWeights)){
+      //the header only declares the weights linked in from the blob
+      for (auto& name: fWeightOrder){
+         const InitializedTensor& tensor = fInitializedTensors[name];
+         hash = HashCode(static_cast<const char*>(tensor.data.get()), ConvertShapeToLength(tensor.shape) * GetTypeSize(tensor.type), hash);
+      }
+   }
+   char key[17];
+   std::snprintf(key, sizeof(key), "%016llx", static_cast<unsigned long long>(hash));
+
+   std::string directory = cache_dir.empty() ? "." : cache_dir;
+   std::string base = fName + "_" + key;
+   std::string stem = directory + "/" + base;
+   std::string symbol = "TMVA_SOFIE_" + fName + "_jit_infer";
+   std::size_t output_length = ConvertShapeToLength(GetTensorShape(fOutputTensorNames[0]));
+   std::vector<std::vector<std::size_t>> input_shapes;
+   for (auto& i: fReadyInputTensorInfos){
+      input_shapes.push_back(i.second.shape);
+   }
+   if (FileExists(stem + ".so")){
+      return RCompiledModel(stem + ".so", symbol, input_shapes, output_length, true);
+   }
+
+   if (mkdir(directory.c_str(), 0755) != 0 && errno != EEXIST){
+      throw std::runtime_error("TMVA SOFIE failed to create the compilation cache directory " + directory);
+   }
+   //written and built in a directory of this call, then renamed into place file by file, so that concurrent
+   //compilations of the same model never see each other's partial files
+   std::string work = stem + ".XXXXXX";
+   if (mkdtemp(&work[0]) == nullptr){
+      throw std::runtime_error("TMVA SOFIE failed to create a build directory in " + directory);
+   }
+   std::vector<std::string> files = {".hxx", ".cxx", ".log"};
+   std::ofstream f(work + "/" + base + ".hxx", std::ios::out | std::ios::binary);
+   f << code;
+   f.close();
+   if (UseOption(Options::kBinaryWeights)){
+      WeightList symbols;
+      for (auto& name: fWeightOrder){
+         symbols.emplace_back("TMVA_SOFIE_" + fName + "_tensor_" + name, &fInitializedTensors[name]);
+      }
+      WriteWeightBlob(work + "/" + base + ".hxx", "model " + fName, symbols, fOptions);
+      files.push_back(".bin");
+      files.push_back("_weights.S");
+   }
+
+   //C entry point, the inputs in the order of the arguments of infer
+   std::string source = "#include <cstddef>\n#include <algorithm>\n#include <vector>\n#include \"" + base + ".hxx\"\n"
+                        "extern \"C\" std::size_t " + symbol + "(float* const* inputs, float* output){\n"
+                        "\tstd::vector<float> ret = TMVA_SOFIE_" + fName + "::infer(";
+   for (std::size_t i = 0; i < fReadyInputTensorInfos.size(); i++){
+      source += (i > 0 ? ", inputs[" : "inputs[") + std::to_string(i) + "]";
+   }
+   source += ");\n"
+             "\tstd::copy(ret.begin(), ret.end(), output);\n"
+             "\treturn ret.size();\n"
+             "}\n";
+   if (UseOption(Options::kProfile)){
+      //totals of the generated Profile namespace, see RCompiledModel::GetProfile
+      source += "extern \"C\" std::size_t " + symbol + "_profile(double* ns, std::uint64_t* calls, std::uint64_t* counters, std::size_t n,\n"
+                "\t                                  std::size_t n_counters, int reset){\n"
+                "\tnamespace profile = TMVA_SOFIE_" + fName + "::Profile;\n"
+                "\tconst std::size_t size = sizeof(profile::ops) / sizeof(profile::ops[0]);\n"
+                "\tconst double ns_per_tick = profile::ns_per_tick();\n"
+                "\tfor (std::size_t i = 0; i < n && i < size; i++){\n"
+                "\t\tns[i] = profile::ops[i].ticks * ns_per_tick;\n"
+                "\t\tcalls[i] = profile::ops[i].count;\n"
+                "\t\tfor (std::size_t k = 0; k < n_counters; k++){\n"
+                "\t\t\tcounters[i * n_counters + k] = k < profile::num_counters ? profile::ops[i].counters[k] : 0;\n"
+                "\t\t}\n"
+                "\t}\n"
+                "\tif (reset) profile::reset();\n"
+                "\treturn size;\n"
+                "}\n";
+      source += "extern \"C\" void " + symbol + "_profile_counters(void (*read)(void*, std::uint64_t*), void* context,\n"
+                "\t                                  const char* const* names, std::size_t n){\n"
+                "\tTMVA_SOFIE_" + fName + "::Profile::set_counters(read, context, names, n);\n"
+                "}\n";
+   }
+   if (UseOption(Options::kLatencyHistogram)){
+      //see RCompiledModel::GetLatencyQuantiles
+      source += "extern \"C\" std::uint64_t " + symbol + "_latency(const double* quantiles, double* values, std::size_t n){\n"
+                "\tstatic thread_local TMVA_SOFIE_" + fName + "::Latency::Snapshot snapshot;\n"
+                "\tsnapshot = TMVA_SOFIE_" + fName + "::Latency::snapshot();\n"
+                "\tfor (std::size_t i = 0; i < n; i++) values[i] = snapshot.quantile(quantiles[i]);\n"
+                "\treturn snapshot.count;\n"
+                "}\n";
+   }
+   f.open(work + "/" + base + ".cxx", std::ios::out | std::ios::binary);
+   f << source;
+   f.close();
+   if (!f){
+      throw std::runtime_error("TMVA SOFIE failed to write the sources of model " + fName + " to " + work);
+   }
+
+   std::string compile = "cd " + Quote(work) + " && " + command + " -shared -fPIC -o " + Quote(base + ".so")
+                         + " " + Quote(base + ".cxx");
+   if (UseOption(Options::kBinaryWeights)) compile += " " + Quote(base + "_weights.S");
+   if (!fNeededBlasRoutines.empty()) compile += " " + blas;
+   compile += " > " + Quote(base + ".log") + " 2>&1";
+   bool compiled = std::system(compile.c_str()) == 0;
+   //the sources and the log stay next to the library, the library comes last so that it is only found complete
+   if (compiled) files.push_back(".so");
+   for (auto& file: files){
+      if (std::rename((work + "/" + base + file).c_str(), (stem + file).c_str()) != 0 && file == ".so"){
+         throw std::runtime_error("TMVA SOFIE failed to move the compiled model to " + stem + file);
+      }
+   }
+   rmdir(work.c_str());   //kept if the compiler left other files behind
+   if (!compiled){
+      throw std::runtime_error("TMVA SOFIE failed to compile model " + fName + ", see " + stem + ".log");
+   }
+   return RCompiledModel(stem + ".so", symbol, input_shapes, output_length, false);
+}
+
+#else
+
+RCompiledModel::RCompiledModel(std::string library, std::string, std::vector<std::vector<std::size_t>>, std::size_t, bool){
+   throw std::runtime_error("TMVA SOFIE cannot load " + library + ", compiled models need dlopen");
+}
+
+std::vector<float> RCompiledModel::Infer(const std::vector<const float*>&) const {
+   return {};
+}
+
+std::vector<RCompiledModel::ProfileEntry> RCompiledModel::GetProfile(bool) const {
+   return {};
+}
+
+void RCompiledModel::SetProfileCounters(const RPerfCounters*){
+}
+
+std::vector<double> RCompiledModel::GetLatencyQuantiles(const std::vector<double>& quantiles, std::uint64_t* count) const {
+   if (count != nullptr) *count = 0;
+   return std::vector<double>(quantiles.size(), 0.);
+}
+
+std::string RCompiledModel::GetTargetFeatures(const std::string&){
+   return "";
+}
+
+RCompiledModel RModel::Compile(std::string, std::string, std::string){
+   throw std::runtime_error("TMVA SOFIE RModel::Compile needs dlopen and is not available on this platform");
+}
+
+#endif
+
+}//SOFIE
+}//Experimental
+}//TMVA
@@ -0,0 +1,396 @@
+#include "RModel.hxx"
+#include "OperatorList.hxx"
+#include "SOFIE_onnx.hxx"
+
+#include <cstring>
+#include <algorithm>
+#include <stdexcept>
+
+namespace TMVA{
+namespace Experimental{
+namespace SOFIE{
+
+namespace{
+
+//file layout: header, metadata, then the initializer data with every tensor aligned to kSnapshotAlignment
+//the metadata is a flat sequence of little records read back in the order it is written below
+constexpr char kSnapshotMagic[8] = {'S', 'O', 'F', 'I', 'E', 'S', 'N', 'P'};
+constexpr std::uint32_t kSnapshotVersion = 1;
+constexpr std::uint32_t kSnapshotByteOrder = 0x01020304;
+constexpr std::uint64_t kSnapshotAlignment = 64;
+
+struct SnapshotHeader{
+   char magic[8];
+   std::uint32_t version;
+   std::uint32_t byte_order;
+   std::uint64_t metadata_size;   //metadata follows the header
+   std::uint64_t data_offset;     //from the start of the file, multiple of kSnapshotAlignment
+   std::uint64_t data_size;
+};
+
+std::uint64_t AlignSnapshotOffset(std::uint64_t offset){
+   return (offset + kSnapshotAlignment - 1) / kSnapshotAlignment * kSnapshotAlignment;
+}
+
+class SnapshotWriter{
+private:
+   std::string fBuffer;
+
+public:
+   template <typename T>
+   void WriteValue(T value){
+      fBuffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+   }
+   void WriteString(const std::string& s){
+      WriteValue<std::uint64_t>(s.size());
+      fBuffer.append(s);
+   }
+   void WriteStrings(const std::vector<std::string>& strings){
+      WriteValue<std::uint64_t>(strings.size());
+      for (auto& s: strings) WriteString(s);
+   }
+   void WriteShape(const std::vector<size_t>& shape){
+      WriteValue<std::uint64_t>(shape.size());
+      for (auto& dim: shape) WriteValue<std::uint64_t>(dim);
+   }
+   void WriteType(ETensorType type){
+      WriteValue<std::int32_t>(static_cast<std::int32_t>(type));
+   }
+   const std::string& GetBuffer() const { return fBuffer; }
+};
+
+class SnapshotReader{
+private:
+   const char* fPos;
+   const char* fEnd;
+
+public:
+   SnapshotReader(const char* data, std::size_t size): fPos(data), fEnd(data + size) {}
+
+   template <typename T>
+   T ReadValue(){
+      if (static_cast<std::size_t>(fEnd - fPos) < sizeof(T)){
+         throw std::runtime_error("TMVA-SOFIE: model snapshot is truncated");
+      }
+      T value;
+      std::memcpy(&value, fPos, sizeof(T));
+      fPos += sizeof(T);
+      return value;
+   }
+   //element counts are bounded by the remaining bytes so that a corrupted file cannot trigger huge allocations
+   std::size_t ReadCount(){
+      std::uint64_t count = ReadValue<std::uint64_t>();
+      if (count > static_cast<std::uint64_t>(fEnd - fPos)){
+         throw std::runtime_error("TMVA-SOFIE: model snapshot is corrupted");
+      }
+      return count;
+   }
+   std::string ReadString(){
+      std::size_t size = ReadCount();
+      std::string s(fPos, size);
+      fPos += size;
+      return s;
+   }
+   std::vector<std::string> ReadStrings(){
+      std::vector<std::string> strings(ReadCount());
+      for (auto& s: strings) s = ReadString();
+      return strings;
+   }
+   std::vector<size_t> ReadShape(){
+      std::vector<size_t> shape(ReadCount());
+      for (auto& dim: shape) dim = ReadValue<std::uint64_t>();
+      return shape;
+   }
+   ETensorType ReadType(){
+      return static_cast<ETensorType>(ReadValue<std::int32_t>());
+   }
+};
+
+void CheckRecord(const OperatorRecord& record, size_t tensors, size_t strings, size_t ints, size_t floats){
+   if (record.type != ETensorType::FLOAT){
+      throw std::runtime_error("TMVA-SOFIE: model snapshot operator " + record.op_type + " of type " + ConvertTypeToString(record.type) + " is not supported");
+   }
+   if (record.tensors.size() != tensors || record.strings.size() != strings || record.ints.size() != ints || record.floats.size() != floats){
+      throw std::runtime_error("TMVA-SOFIE: model snapshot has a malformed " + record.op_type + " operator");
+   }
+}
+
+std::unique_ptr<ROperator> MakeOperator(const OperatorRecord& record){
+   std::unique_ptr<ROperator> op;
+   if (record.op_type == "Gemm"){
+      CheckRecord(record, 4, 0, 1, 2);
+      if (record.ints[0].size() != 2) throw std::runtime_error("TMVA-SOFIE: model snapshot has a malformed Gemm operator");
+      if (record.tensors[2].empty()){
+         op.reset(new ROperator_Gemm<float>(record.floats[0], record.floats[1], record.ints[0][0], record.ints[0][1], record.tensors[0], record.tensors[1], record.tensors[3]));
+      }else{
+         op.reset(new ROperator_Gemm<float>(record.floats[0], record.floats[1], record.ints[0][0], record.ints[0][1], record.tensors[0], record.tensors[1], record.tensors[2], record.tensors[3]));
+      }
+   }else if (record.op_type == "Conv"){
+      CheckRecord(record, 4, 1, 4, 0);
+      if (record.ints[0].size() != 1) throw std::runtime_error("TMVA-SOFIE: model snapshot has a malformed Conv operator");
+      std::vector<size_t> dilations(record.ints[1].begin(), record.ints[1].end());
+      std::vector<size_t> pads(record.ints[2].begin(), record.ints[2].end());
+      std::vector<size_t> strides(record.ints[3].begin(), record.ints[3].end());
+      if (record.tensors[2].empty()){
+         op.reset(new ROperator_Conv<float>(record.strings[0], dilations, record.ints[0][0], {}, pads, strides, record.tensors[0], record.tensors[1], record.tensors[3]));
+      }else{
+         op.reset(new ROperator_Conv<float>(record.strings[0], dilations, record.ints[0][0], {}, pads, strides, record.tensors[0], record.tensors[1], record.tensors[2], record.tensors[3]));
+      }
+   }else if (record.op_type == "Relu"){
+      CheckRecord(record, 2, 0, 0, 0);
+      op.reset(new ROperator_Relu<float>(record.tensors[0], record.tensors[1]));
+   }else if (record.op_type == "Transpose"){
+      CheckRecord(record, 2, 0, 1, 0);
+      op.reset(new ROperator_Transpose<float>(record.ints[0], record.tensors[0], record.tensors[1]));
+   }else{
+      throw std::runtime_error("TMVA-SOFIE: model snapshot operator type " + record.op_type + " is not supported");
+   }
+   return op;
+}
+
+template <typename Map>
+std::vector<std::string> SortedKeys(const Map& map){
+   std::vector<std::string> keys;
+   for (auto& i: map) keys.push_back(i.first);
+   std::sort(keys.begin(), keys.end());
+   return keys;
+}
+
+}//anonymous namespace
+
+void RModel::SaveSnapshot(std::string filename){
+   if (!fGC.empty()){
+      throw std::runtime_error("TMVA-SOFIE: a model snapshot has to be saved before the code is generated");
+   }
+   //infer shapes and broadcast but keep the weights as parsed, so that any generation option can be applied after loading
+   auto options = fOptions;
+   fOptions = static_cast<std::underlying_type_t<Options>>(Options::kShapesOnly);
+   Initialize();
+   fOptions = options;
+
+   SnapshotWriter writer;
+   writer.WriteString(fFileName);
+   writer.WriteString(fParseTime);
+   writer.WriteStrings(std::vector<std::string>(fNeededBlasRoutines.begin(), fNeededBlasRoutines.end()));
+   writer.WriteStrings(std::vector<std::string>(fNeededStdLib.begin(), fNeededStdLib.end()));
+   writer.WriteValue<float>(fSparseWeightThreshold);
+   writer.WriteValue<float>(fSparseInputDensity);
+   writer.WriteStrings(std::vector<std::string>(fSparseInputLayers.begin(), fSparseInputLayers.end()));
+
+   auto names = SortedKeys(fInputTensorInfos);
+   writer.WriteValue<std::uint64_t>(names.size());
+   for (auto& name: names){
+      auto& info = fInputTensorInfos[name];
+      writer.WriteString(name);
+      writer.WriteType(info.type);
+      writer.WriteValue<std::uint64_t>(info.shape.size());
+      for (auto& dim: info.shape){
+         writer.WriteValue<std::uint8_t>(dim.isParam);
+         writer.WriteValue<std::uint64_t>(dim.isParam ? 0 : dim.dim);
+         writer.WriteString(dim.param);
+      }
+   }
+
+   names = SortedKeys(fReadyInputTensorInfos);
+   writer.WriteValue<std::uint64_t>(names.size());
+   for (auto& name: names){
+      writer.WriteString(name);
+      writer.WriteType(fReadyInputTensorInfos[name].type);
+      writer.WriteShape(fReadyInputTensorInfos[name].shape);
+   }
+
+   //data offsets are relative to the data section
+   auto initialized_names = SortedKeys(fInitializedTensors);
+   std::vector<std::uint64_t> offsets;
+   std::uint64_t data_size = 0;
+   writer.WriteValue<std::uint64_t>(initialized_names.size());
+   for (auto& name: initialized_names){
+      auto& tensor = fInitializedTensors[name];
+      std::uint64_t size = ConvertShapeToLength(tensor.shape) * GetTypeSize(tensor.type);
+      data_size = AlignSnapshotOffset(data_size);
+      offsets.push_back(data_size);
+      writer.WriteString(name);
+      writer.WriteType(tensor.type);
+      writer.WriteShape(tensor.shape);
+      writer.WriteValue<std::uint64_t>(data_size);
+      writer.WriteValue<std::uint64_t>(size);
+      data_size += size;
+   }
+
+   names = SortedKeys(fIntermediateTensorInfos);
+   writer.WriteValue<std::uint64_t>(names.size());
+   for (auto& name: names){
+      writer.WriteString(name);
+      writer.WriteType(fIntermediateTensorInfos[name].type);
+      writer.WriteShape(fIntermediateTensorInfos[name].shape);
+   }
+
+   writer.WriteStrings(fOutputTensorNames);
+
+   names = SortedKeys(fActivationRanges);
+   writer.WriteValue<std::uint64_t>(names.size());
+   for (auto& name: names){
+      writer.WriteString(name);
+      writer.WriteValue<float>(fActivationRanges[name].first);
+      writer.WriteValue<float>(fActivationRanges[name].second);
+   }
+
+   writer.WriteValue<std::uint64_t>(fOperators.size());
+   for (auto& op: fOperators){
+      OperatorRecord record = op->GetRecord();
+      writer.WriteString(record.op_type);
+      writer.WriteType(record.type);
+      writer.WriteStrings(record.tensors);
+      writer.WriteStrings(record.strings);
+      writer.WriteValue<std::uint64_t>(record.ints.size());
+      for (auto& ints: record.ints){
+         writer.WriteValue<std::uint64_t>(ints.size());
+         for (auto& i: ints) writer.WriteValue<std::int64_t>(i);
+      }
+      writer.WriteValue<std::uint64_t>(record.floats.size());
+      for (auto& f: record.floats) writer.WriteValue<float>(f);
+   }
+
+   SnapshotHeader header;
+   std::memcpy(header.magic, kSnapshotMagic, sizeof(header.magic));
+   header.version = kSnapshotVersion;
+   header.byte_order = kSnapshotByteOrder;
+   header.metadata_size = writer.GetBuffer().size();
+   header.data_offset = AlignSnapshotOffset(sizeof(SnapshotHeader) + header.metadata_size);
+   header.data_size = data_size;
+
+   std::ofstream f(filename, std::ios::out | std::ios::binary);
+   if (!f.is_open()){
+      throw std::runtime_error("TMVA-SOFIE: failed to open " + filename + " to write the model snapshot");
+   }
+   const std::vector<char> padding(kSnapshotAlignment, 0);
+   f.write(reinterpret_cast<const char*>(&header), sizeof(header));
+   f.write(writer.GetBuffer().data(), writer.GetBuffer().size());
+   f.write(padding.data(), header.data_offset - sizeof(header) - header.metadata_size);
+   std::uint64_t written = 0;
+   for (size_t i = 0; i < initialized_names.size(); i++){
+      auto& tensor = fInitializedTensors[initialized_names[i]];
+      f.write(padding.data(), offsets[i] - written);
+      std::uint64_t size = ConvertShapeToLength(tensor.shape) * GetTypeSize(tensor.type);
+      f.write(static_cast<const char*>(tensor.data.get()), size);
+      written = offsets[i] + size;
+   }
+   if (!f.good()){
+      throw std::runtime_error("TMVA-SOFIE: failed to write the model snapshot " + filename);
+   }
+}
+
+RModel RModel::LoadSnapshot(std::string filename){
+   //initializers are views into the mapping, which they keep alive
+   auto file = std::make_shared<MappedFile>(filename);
+   SnapshotHeader header;
+   if (file->size() < sizeof(header)){
+      throw std::runtime_error("TMVA-SOFIE: " + filename + " is not a model snapshot");
+   }
+   std::memcpy(&header, file->data(), sizeof(header));
+   if (std::memcmp(header.magic, kSnapshotMagic, sizeof(header.magic)) != 0){
+      throw std::runtime_error("TMVA-SOFIE: " + filename + " is not a model snapshot");
+   }
+   if (header.version != kSnapshotVersion){
+      throw std::runtime_error("TMVA-SOFIE: model snapshot " + filename + " has version " + std::to_string(header.version) + ", expected " + std::to_string(kSnapshotVersion));
+   }
+   if (header.byte_order != kSnapshotByteOrder){
+      throw std::runtime_error("TMVA-SOFIE: model snapshot " + filename + " was written on a machine with a different byte order");
+   }
+   if (header.metadata_size > file->size() - sizeof(header) || header.data_offset > file->size() || header.data_size > file->size() - header.data_offset){
+      throw std::runtime_error("TMVA-SOFIE: model snapshot " + filename + " is truncated");
+   }
+
+   SnapshotReader reader(file->data() + sizeof(header), header.metadata_size);
+   std::string filename_original = reader.ReadString();
+   std::string parsetime = reader.ReadString();
+   RModel model(filename_original, parsetime);
+   for (auto& routine: reader.ReadStrings()) model.fNeededBlasRoutines.insert(routine);
+   for (auto& lib: reader.ReadStrings()) model.fNeededStdLib.insert(lib);
+   model.fSparseWeightThreshold = reader.ReadValue<float>();
+   model.fSparseInputDensity = reader.ReadValue<float>();
+   for (auto& layer: reader.ReadStrings()) model.fSparseInputLayers.insert(layer);
+
+   std::size_t count = reader.ReadCount();
+   for (std::size_t i = 0; i < count; i++){
+      std::string name = reader.ReadString();
+      InputTensorInfo info;
+      info.type = reader.ReadType();
+      info.shape.resize(reader.ReadCount());
+      for (auto& dim: info.shape){
+         dim.isParam = reader.ReadValue<std::uint8_t>();
+         dim.dim = reader.ReadValue<std::uint64_t>();
+         dim.param = reader.ReadString();
+      }
+      InputTensorInfo& stored = model.fInputTensorInfos[name];
+      stored = info;
+      model.RegisterTensor(name, ETensorKind::kInput, &stored.type, nullptr);
+   }
+
+   count = reader.ReadCount();
+   for (std::size_t i = 0; i < count; i++){
+      std::string name = reader.ReadString();
+      ETensorType type = reader.ReadType();
+      TensorInfo& stored = model.fReadyInputTensorInfos[name];
+      stored = TensorInfo{type, reader.ReadShape()};
+      model.RegisterTensor(name, ETensorKind::kReadyInput, &stored.type, &stored.shape);
+   }
+
+   count = reader.ReadCount();
+   for (std::size_t i = 0; i < count; i++){
+      std::string name = reader.ReadString();
+      ETensorType type = reader.ReadType();
+      std::vector<size_t> shape = reader.ReadShape();
+      std::uint64_t offset = reader.ReadValue<std::uint64_t>();
+      std::uint64_t size = reader.ReadValue<std::uint64_t>();
+      if (size != ConvertShapeToLength(shape) * GetTypeSize(type) || offset > header.data_size || size > header.data_size - offset){
+         throw std::runtime_error("TMVA-SOFIE: model snapshot " + filename + " has corrupted data for tensor " + name);
+      }
+      std::shared_ptr<void> data(file, file->data() + header.data_offset + offset);
+      InitializedTensor& stored = model.fInitializedTensors[name];
+      stored = InitializedTensor{type, shape, data};
+      model.RegisterTensor(name, ETensorKind::kInitialized, &stored.type, &stored.shape);
+   }
+
+   count = reader.ReadCount();
+   for (std::size_t i = 0; i < count; i++){
+      std::string name = reader.ReadString();
+      ETensorType type = reader.ReadType();
+      TensorInfo& stored = model.fIntermediateTensorInfos[name];
+      stored = TensorInfo{type, reader.ReadShape()};
+      model.RegisterTensor(name, ETensorKind::kIntermediate, &stored.type, &stored.shape);
+   }
+
+   model.fOutputTensorNames = reader.ReadStrings();
+
+   count = reader.ReadCount();
+   for (std::size_t i = 0; i < count; i++){
+      std::string name = reader.ReadString();
+      float min = reader.ReadValue<float>();
+      float max = reader.ReadValue<float>();
+      model.fActivationRanges[name] = std::make_pair(min, max);
+   }
+
+   count = reader.ReadCount();
+   for (std::size_t i = 0; i < count; i++){
+      OperatorRecord record;
+      record.op_type = reader.ReadString();
+      record.type = reader.ReadType();
+      record.tensors = reader.ReadStrings();
+      record.strings = reader.ReadStrings();
+      record.ints.resize(reader.ReadCount());
+      for (auto& ints: record.ints){
+         ints.resize(reader.ReadCount());
+         for (auto& value: ints) value = reader.ReadValue<std::int64_t>();
+      }
+      record.floats.resize(reader.ReadCount());
+      for (auto& value: record.floats) value = reader.ReadValue<float>();
+      model.fOperators.push_back(MakeOperator(record));
+   }
+
+   return model;
+}
+
+}//SOFIE
+}//Experimental
+}//TMVA
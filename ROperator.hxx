@@ -3,6 +3,7 @@
 
 #include <vector>
 #include <memory>
+#include <stdexcept>
 
 #include "SOFIE_common.hxx"
 //#include "RModel.hxx"
@@ -14,6 +15,7 @@ namespace Experimental{
 namespace SOFIE{
 
 class RModel;
+class RInterpreter;
 
 class ROperator{
 
@@ -24,10 +26,26 @@ public:
    virtual void Initialize(RModel&) = 0;
    virtual std::string Generate(std::string OpName) = 0;  //expect unique opname for each operator within the same RModel
    virtual std::string Header() { return "";}
-
-
-   //virtual void Forward_reference() = 0;
-   //irtual void Forward_blas() = 0;
+   //ONNX operator type, as reported by the profile and the cost and memory reports
+   virtual std::string GetOpType() { return "Op"; }
+   //attributes to rebuild the operator from a model snapshot, valid until Generate is called
+   virtual OperatorRecord GetRecord() {
+      throw std::runtime_error("TMVA SOFIE operator does not support model snapshots");
+   }
+
+
+   //floating point operations of one inference, from the shapes known after Initialize
+   virtual std::size_t GetFlops() { return 0; }
+   //tensors read and written by one inference once initialized, a converted weight with its companion arrays
+   virtual std::vector<std::string> GetInputTensorNames() { return {}; }
+   virtual std::vector<std::string> GetOutputTensorNames() { return {}; }
+   //bytes of the local arrays its generated code declares in infer, which stay on the stack until infer returns
+   virtual std::size_t GetScratchBytes() { return 0; }
+
+   //runs the operator in process on the tensors of an interpreter, with the float semantics of the generated code
+   virtual void Forward_reference(RInterpreter&) {
+      throw std::runtime_error("TMVA SOFIE operator does not support the interpreter");
+   }
    virtual ~ROperator(){}
 
 
@@ -2,8 +2,10 @@
 #define TMVA_SOFIE_ROPERATOR_CONV
 
 #include "SOFIE_common.hxx"
+#include "SOFIE_kernels.hxx"
 #include "ROperator.hxx"
 #include "RModel.hxx"
+#include "RInterpreter.hxx"
 
 #include <memory>
 #include <sstream>
@@ -12,6 +14,7 @@
 #include <iomanip>
 #include <stdexcept>
 #include <vector>
+#include <cmath>
 
 namespace TMVA {
 namespace Experimental {
@@ -37,9 +40,18 @@ private:
    std::vector<size_t> fShapeW;
    std::vector<size_t> fShapeB;
    std::vector<size_t> fShapeY;
+   TensorId fIdX = 0;
+   TensorId fIdW = 0;
+   TensorId fIdB = 0;
+   TensorId fIdY = 0;
 
    std::string fType;
 
+   bool fUseInt8 = false;           //W quantized to int8 rows of length fKPadded, one per output channel
+   size_t fKPadded = 0;
+   float fActivationScale = 0;      //int8 scale of X from calibration, 0 means computed at run time
+   bool fUnsignedActivation = false;   //X calibrated non negative, e.g. after a Relu, and quantized to uint8
+
 public:
 
    ROperator_Conv() = delete;
@@ -98,8 +110,10 @@ public:
          fAttrGroup = input[0][1] / input[1][1];
       }
 
-      size_t kHeight = ((fAttrKernelShape.empty())? input[1][2] : fAttrKernelShape[0]);
-      size_t kWidth = ((fAttrKernelShape.empty())? input[1][3] : fAttrKernelShape[1]);
+      //kernel extent from W (ONNX requires kernel_shape to agree with it): fAttrKernelShape is overwritten
+      //with the dilated extent below, reading it back would dilate again when the model is initialized twice
+      size_t kHeight = input[1][2];
+      size_t kWidth = input[1][3];
 
       if (fAttrDilations.empty()) {
          fAttrDilations = {1, 1};
@@ -151,21 +165,29 @@ public:
                std::runtime_error("TMVA SOFIE Conv op Input Tensor " + fNB + " is not found in model");
          }
       }
-      fShapeX = model.GetTensorShape(fNX);
+      fIdX = model.GetTensorId(fNX);
+      fIdW = model.GetTensorId(fNW);
+      fShapeX = model.GetTensorShape(fIdX);
       if (fShapeX.size() != 4) {
          throw
             std::runtime_error("TMVA SOFIE Conv Op input tensor" + fNX + " is not of 4 dimensions");
       }
-      fShapeW = model.GetTensorShape(fNW);
+      fShapeW = model.GetTensorShape(fIdW);
       if (fShapeW.size() != 4) {
          throw
             std::runtime_error("TMVA SOFIE Conv Op input tensor" + fNW + " is not of 4 dimensions");
       }
       fShapeY = ShapeInference({fShapeX, fShapeW})[0];
+      if (fAttrGroup == 0 || fShapeX[1] != fAttrGroup * fShapeW[1] || fShapeW[0] % fAttrGroup != 0) {
+         throw
+            std::runtime_error("TMVA SOFIE Conv Op " + fNY + " with " + std::to_string(fAttrGroup) + " groups does not split "
+                               + std::to_string(fShapeX[1]) + " input and " + std::to_string(fShapeW[0]) + " output channels");
+      }
       if (fNB != "") {
-         fShapeB = model.GetTensorShape(fNB);
+         fIdB = model.GetTensorId(fNB);
+         fShapeB = model.GetTensorShape(fIdB);
 
-         bool broadcast_needed = (fShapeB.size() != fShapeY.size());
+         bool broadcast_needed = (fShapeB != fShapeY);   //the bias is added over the whole of Y
          if (broadcast_needed) {
             auto original_data = model.GetInitializedTensorData(fNB);
             if (fType == "float") {
@@ -177,7 +199,189 @@ public:
          }
       }
 
-      model.AddIntermediateTensor(fNY, model.GetTensorType(fNX), fShapeY);
+      if (model.UseOption(Options::kInt8) && fType == "float" && fAttrGroup == 1 && model.IsInitializedTensor(fIdW)) {
+         InitializeInt8(model);
+      }
+
+      model.AddIntermediateTensor(fNY, model.GetTensorType(fIdX), fShapeY);
+      fIdY = model.GetTensorId(fNY);
+   }
+
+   //a multiply and an add per filter tap and output, plus the bias
+   std::size_t GetFlops() {
+      return ConvertShapeToLength(fShapeY) * (2 * fShapeW[1] * fShapeW[2] * fShapeW[3] + (fNB.empty() ? 0 : 1));
+   }
+
+   //the padded input, column matrix and filter scratch of the generated code are counted by GetScratchBytes
+   std::vector<std::string> GetInputTensorNames() {
+      std::vector<std::string> names = {fNX, fNW};
+      if (fUseInt8) {
+         names.push_back(fNW + "scale");
+         names.push_back(fNW + "sum");
+      }
+      if (!fNB.empty()) names.push_back(fNB);
+      return names;
+   }
+   std::vector<std::string> GetOutputTensorNames() {
+      return {fNY};
+   }
+
+   //_xpad and _xcol, then _xq of the int8 code or the filter matrix _f
+   std::size_t GetScratchBytes() {
+      std::size_t xpad = fShapeX[0] * fShapeX[1] * (fShapeX[2] + fAttrPads[0] + fAttrPads[2]) * (fShapeX[3] + fAttrPads[1] + fAttrPads[3]);
+      std::size_t npix = fShapeX[0] * fShapeY[2] * fShapeY[3];
+      std::size_t xcol = fShapeX[1] * fAttrKernelShape[0] * fAttrKernelShape[1] * npix;
+      std::size_t bytes = (xpad + xcol) * sizeof(float);
+      if (fUseInt8) return bytes + npix * fKPadded * sizeof(std::int8_t);
+      return bytes + fShapeW[0] * fShapeW[1] * fAttrKernelShape[0] * fAttrKernelShape[1] * sizeof(float);
+   }
+
+   //same padded input, column matrix and (dilated) filter matrix as the generated float code
+   void Forward_reference(RInterpreter& interpreter) {
+      if (fUseInt8) {
+         throw
+            std::runtime_error("TMVA SOFIE Conv Op " + fNY + " with int8 weights cannot be interpreted");
+      }
+      const T* X = interpreter.GetTensorData<T>(fIdX);
+      const T* W = interpreter.GetTensorData<T>(fIdW);
+      T* Y = interpreter.GetTensorData<T>(fIdY);
+      size_t hpad = fShapeX[2] + fAttrPads[0] + fAttrPads[2];
+      size_t wpad = fShapeX[3] + fAttrPads[1] + fAttrPads[3];
+      size_t m = fShapeW[0];
+      size_t mg = m / fAttrGroup;
+      size_t kg = fShapeW[1] * fAttrKernelShape[0] * fAttrKernelShape[1];
+      size_t k = fShapeX[1] * fAttrKernelShape[0] * fAttrKernelShape[1];
+      size_t npix = fShapeX[0] * fShapeY[2] * fShapeY[3];
+      size_t xpad_length = fShapeX[0] * fShapeX[1] * hpad * wpad;
+
+      T* xpad = interpreter.GetScratch(xpad_length + k * npix + m * kg);
+      T* xcol = xpad + xpad_length;
+      T* f = xcol + k * npix;
+      std::fill(xpad, xpad + xpad_length, 0);
+      for (size_t n = 0; n < fShapeX[0]; n++) {
+         for (size_t c = 0; c < fShapeX[1]; c++) {
+            for (size_t h = 0; h < fShapeX[2]; h++) {
+               std::copy(X + ((n * fShapeX[1] + c) * fShapeX[2] + h) * fShapeX[3], X + ((n * fShapeX[1] + c) * fShapeX[2] + h + 1) * fShapeX[3],
+                         xpad + ((n * fShapeX[1] + c) * hpad + h + fAttrPads[0]) * wpad + fAttrPads[1]);
+            }
+         }
+      }
+      size_t idx = 0;
+      for (size_t n = 0; n < fShapeX[0]; n++) {
+         for (size_t h = 0; h < hpad - fAttrKernelShape[0] + 1; h += fAttrStrides[0]) {
+            for (size_t w = 0; w < wpad - fAttrKernelShape[1] + 1; w += fAttrStrides[1]) {
+               for (size_t c = 0; c < fShapeX[1]; c++) {
+                  for (size_t x = 0; x < fAttrKernelShape[0]; x++) {
+                     for (size_t y = 0; y < fAttrKernelShape[1]; y++) {
+                        xcol[idx++] = xpad[((n * fShapeX[1] + c) * hpad + h + x) * wpad + w + y];
+                     }
+                  }
+               }
+            }
+         }
+      }
+      std::fill(f, f + m * kg, 0);
+      for (size_t oc = 0; oc < fShapeW[0]; oc++) {
+         for (size_t d = 0; d < fShapeW[1]; d++) {
+            for (size_t h = 0; h < fShapeW[2]; h++) {
+               for (size_t w = 0; w < fShapeW[3]; w++) {
+                  f[oc + (d * fAttrKernelShape[0] * fAttrKernelShape[1] + h * fAttrDilations[0] * fAttrKernelShape[1] + w * fAttrDilations[1]) * m] =
+                     W[((oc * fShapeW[1] + d) * fShapeW[2] + h) * fShapeW[3] + w];
+               }
+            }
+         }
+      }
+      //row major Y (m x npix) = f (m x kg) * xcol (k x npix), group g on the rows g * kg of xcol and g * mg of f and Y
+      for (size_t g = 0; g < fAttrGroup; g++) {
+         for (size_t i = g * mg; i < (g + 1) * mg; i++) {
+            T* y = Y + i * npix;
+            for (size_t j = 0; j < npix; j++) {
+               const T* column = xcol + j * k + g * kg;
+               T sum = 0;
+               for (size_t p = 0; p < kg; p++) {
+                  sum += f[i + p * m] * column[p];
+               }
+               y[j] = sum;
+            }
+         }
+      }
+      if (fNB != "") {
+         const T* B = interpreter.GetTensorData<T>(fIdB);
+         size_t length = ConvertShapeToLength(fShapeY);
+         for (size_t i = 0; i < length; i++) {
+            Y[i] += B[i];
+         }
+      }
+   }
+
+   std::string GetOpType() {
+      return "Conv";
+   }
+
+   OperatorRecord GetRecord() {
+      OperatorRecord record;
+      record.op_type = GetOpType();
+      record.tensors = {fNX, fNW, fNB, fNY};
+      record.strings = {fAttrAutopad};
+      record.ints = {{static_cast<std::int64_t>(fAttrGroup)},
+                     std::vector<std::int64_t>(fAttrDilations.begin(), fAttrDilations.end()),
+                     std::vector<std::int64_t>(fAttrPads.begin(), fAttrPads.end()),
+                     std::vector<std::int64_t>(fAttrStrides.begin(), fAttrStrides.end())};
+      return record;
+   }
+
+   void InitializeInt8(RModel& model) {
+      // Same (dilated) filter matrix as the one built at run time in the float path, one row per output channel
+      size_t m = fShapeW[0];
+      size_t k = fShapeW[1] * fAttrKernelShape[0] * fAttrKernelShape[1];
+      fKPadded = (k + KERNELS::kInt8RowAlignment - 1) / KERNELS::kInt8RowAlignment * KERNELS::kInt8RowAlignment;
+      const float* original_data = static_cast<float*>(model.GetInitializedTensorData(fNW).get());
+      std::vector<float> rows(m * k, 0.);
+      for (size_t oc = 0; oc < fShapeW[0]; oc++) {
+         for (size_t d = 0; d < fShapeW[1]; d++) {
+            for (size_t h = 0; h < fShapeW[2]; h++) {
+               for (size_t w = 0; w < fShapeW[3]; w++) {
+                  rows[oc * k + d * fAttrKernelShape[0] * fAttrKernelShape[1] + h * fAttrDilations[0] * fAttrKernelShape[1] + w * fAttrDilations[1]] =
+                     original_data[oc * fShapeW[1] * fShapeW[2] * fShapeW[3] + d * fShapeW[2] * fShapeW[3] + h * fShapeW[3] + w];
+               }
+            }
+         }
+      }
+      std::shared_ptr<void> quantized(malloc(m * fKPadded * sizeof(std::int8_t)), free);
+      std::shared_ptr<void> scales(malloc(m * sizeof(float)), free);
+      std::shared_ptr<void> sums(malloc(m * sizeof(std::int32_t)), free);
+      UTILITY::QuantizeRowsInt8(rows.data(), m, k, fKPadded, static_cast<std::int8_t*>(quantized.get()),
+                                static_cast<float*>(scales.get()), static_cast<std::int32_t*>(sums.get()));
+      std::vector<float> dequantized(m * k);
+      for (size_t oc = 0; oc < m; oc++) {
+         for (size_t j = 0; j < k; j++) {
+            dequantized[oc * k + j] = static_cast<std::int8_t*>(quantized.get())[oc * fKPadded + j] * static_cast<float*>(scales.get())[oc];
+         }
+      }
+      // a filter shared with other operators keeps its float values, the int8 rows are this operator's own
+      if (model.IsReadByOtherOperators(fNW)) {
+         model.ReleaseTensor(fNW);
+         fNW = fNW + "for" + fNY;
+         model.AddInitializedTensor(fNW, ETensorType::INT8, {m, fKPadded}, quantized);
+      } else {
+         model.UpdateInitializedTensor(fNW, ETensorType::INT8, {m, fKPadded}, quantized);
+      }
+      fIdW = model.GetTensorId(fNW);
+      model.AddWeightConversionInfo(fNW, ETensorType::INT8, rows.data(), dequantized.data(), m * k);
+      model.AddInitializedTensor(fNW + "scale", ETensorType::FLOAT, {m}, scales);
+      model.AddInitializedTensor(fNW + "sum", ETensorType::INT32, {m}, sums);
+
+      float min, max;
+      if (model.GetActivationRange(fNX, min, max)) {
+         fUnsignedActivation = min >= 0;
+         fActivationScale = fUnsignedActivation ? max / 255.f : std::max(std::fabs(min), std::fabs(max)) / 127.f;
+         if (!(fActivationScale > 0)) fActivationScale = 1.f;   // constant zero input
+      }
+      fUseInt8 = true;
+   }
+
+   std::string Header() {
+      return (fUseInt8 ? KERNELS::Int8Gemm() : "");
    }
 
    std::string Generate(std::string OpName) {
@@ -187,7 +391,6 @@ public:
          throw
             std::runtime_error("TMVA SOFIE Conv Op called to Generate without being initialized first");
       }
-
       std::stringstream out;
 
       if (fType == "float") {
@@ -209,18 +412,15 @@ public:
          out << "\t" << "float ";
       }
       out << OpName << "_xcol[" << fShapeX[1] * fAttrKernelShape[0] * fAttrKernelShape[1] * fShapeX[0] * fShapeY[2] * fShapeY[3] << "] = {0};\n";
-      // Unroll the input tensor
-      out << "\t" << "for (size_t g = 0; g < " << fAttrGroup << "; g++) {\n";
-      out << "\t" << "\t" << "size_t idx = g * " << fShapeW[1] * fAttrKernelShape[0] * fAttrKernelShape[1] << ";\n";
-      out << "\t" << "\t" << "for (size_t n = 0; n < " << fShapeX[0] << "; n++) {\n";
-      out << "\t" << "\t" << "\t" << "for (size_t c = g * " << fShapeW[1] << "; c < (g + 1) * " << fShapeW[1] << "; c++) {\n";
-      out << "\t" << "\t" << "\t" << "\t" << "for (size_t h = 0; h < " << fShapeX[2] + fAttrPads[0] + fAttrPads[2] - fAttrKernelShape[0] + 1 << "; h += " << fAttrStrides[0] << ") {\n";
-      out << "\t" << "\t" << "\t" << "\t" << "\t" << "for (size_t w = 0; w < " << fShapeX[3] + fAttrPads[1] + fAttrPads[3] - fAttrKernelShape[1] + 1 << ";w += " << fAttrStrides[1] << ") {\n";
-      out << "\t" << "\t" << "\t" << "\t" << "\t" << "\t" << "for (size_t x = 0; x < " << fAttrKernelShape[0] << "; x++) {\n";
-      out << "\t" << "\t" << "\t" << "\t" << "\t" << "\t" << "\t" << "for (size_t y = 0; y < " << fAttrKernelShape[1] << "; y++) {\n";
-      out << "\t" << "\t" << "\t" << "\t" << "\t" << "\t" << "\t" << "\t" << OpName << "_xcol[" << "idx] = " << OpName << "_xpad[n * " <<  fShapeX[1] * (fShapeX[2] + fAttrPads[0] + fAttrPads[2]) * (fShapeX[3] + fAttrPads[1] + fAttrPads[3]) << " + c * " << (fShapeX[2] + fAttrPads[0] + fAttrPads[2]) * (fShapeX[3] + fAttrPads[1] + fAttrPads[3]) << " + (h + x) * " << (fShapeX[3] + fAttrPads[1] + fAttrPads[3]) << " + w + y];\n";
-      out << "\t" << "\t" << "\t" << "\t" << "\t" << "\t" << "\t" << "\t" << "idx++;\n";
-      out << "\t" << "\t" << "\t" << "\t" << "\t" << "\t" << "\t" << "}\n";
+      // Unroll the input tensor: column j of the k x npix matrix xcol is the receptive field of output pixel j, channel
+      // by channel, so that the channels of a group are a block of rows
+      out << "\t" << "for (size_t n = 0, idx = 0; n < " << fShapeX[0] << "; n++) {\n";
+      out << "\t" << "\t" << "for (size_t h = 0; h < " << fShapeX[2] + fAttrPads[0] + fAttrPads[2] - fAttrKernelShape[0] + 1 << "; h += " << fAttrStrides[0] << ") {\n";
+      out << "\t" << "\t" << "\t" << "for (size_t w = 0; w < " << fShapeX[3] + fAttrPads[1] + fAttrPads[3] - fAttrKernelShape[1] + 1 << "; w += " << fAttrStrides[1] << ") {\n";
+      out << "\t" << "\t" << "\t" << "\t" << "for (size_t c = 0; c < " << fShapeX[1] << "; c++) {\n";
+      out << "\t" << "\t" << "\t" << "\t" << "\t" << "for (size_t x = 0; x < " << fAttrKernelShape[0] << "; x++) {\n";
+      out << "\t" << "\t" << "\t" << "\t" << "\t" << "\t" << "for (size_t y = 0; y < " << fAttrKernelShape[1] << "; y++) {\n";
+      out << "\t" << "\t" << "\t" << "\t" << "\t" << "\t" << "\t" << OpName << "_xcol[" << "idx++] = " << OpName << "_xpad[n * " <<  fShapeX[1] * (fShapeX[2] + fAttrPads[0] + fAttrPads[2]) * (fShapeX[3] + fAttrPads[1] + fAttrPads[3]) << " + c * " << (fShapeX[2] + fAttrPads[0] + fAttrPads[2]) * (fShapeX[3] + fAttrPads[1] + fAttrPads[3]) << " + (h + x) * " << (fShapeX[3] + fAttrPads[1] + fAttrPads[3]) << " + w + y];\n";
       out << "\t" << "\t" << "\t" << "\t" << "\t" << "\t" << "}\n";
       out << "\t" << "\t" << "\t" << "\t" << "\t" << "}\n";
       out << "\t" << "\t" << "\t" << "\t" << "}\n";
@@ -228,70 +428,62 @@ public:
       out << "\t" << "\t" << "}\n";
       out << "\t" << "}\n";
 
-      if (fType == "float") {
-         out << "\t" << "float ";
-      }
-      // convolution kernels
-      out << OpName << "_f[" << fShapeW[0] * fShapeW[1] * fAttrKernelShape[0] * fAttrKernelShape[1] << "] = {0};\n";
-      // vectorize the (dilated)convolution kernels into a matrix
-      out << "\t" << "for (std::size_t k = 0; k < " << fShapeW[0] << "; k++) {\n";
-      out << "\t" << "\t" << "for (std::size_t d = 0; d < " << fShapeW[1] << "; d++) {\n";
-      out << "\t" << "\t" << "\t" << "for (std::size_t h = 0; h < " << fShapeW[2] << "; h++) {\n";
-      out << "\t" << "\t" << "\t" << "\t" << "for (std::size_t w = 0; w < " << fShapeW[3] << "; w++) {\n";
-      out << "\t" << "\t" << "\t" << "\t" << "\t" << OpName <<  "_f[k + " << "(d * " << fAttrKernelShape[0] * fAttrKernelShape[1] << " + h * " << fAttrDilations[0] * fAttrKernelShape[1] << " + w * " << fAttrDilations[1] << ") * " << fShapeW[0] << "] = tensor_" << fNW << "[k * " << fShapeW[1] * fShapeW[2] * fShapeW[3] << " + d * " << fShapeW[2] * fShapeW[3] << " + h * " << fShapeW[3] << " + w ];\n";
-      out << "\t" << "\t" << "\t" << "\t" << "}\n";
-      out << "\t" << "\t" << "\t" << "}\n";
-      out << "\t" << "\t" << "}\n";
-      out << "\t" << "}\n";
-
-      if (fAttrGroup == 1) {
-         out << "\t" << "char " << OpName << "_transF = 'N';\n";
-         out << "\t" << "char " << OpName << "_transXcol = 'N';\n";
-         out << "\t" << "int " << OpName << "_m = " << fShapeW[0] << ";\n";
-         out << "\t" << "int " << OpName << "_n = " << fShapeX[0] * fShapeY[2] * fShapeY[3] << ";\n";
-         out << "\t" << "int " << OpName << "_k = " << fShapeW[1] * fAttrKernelShape[0] * fAttrKernelShape[1] << ";\n";
-         out << "\t" << "float " << OpName << "_alpha = 1.0;\n";
-         out << "\t" << "float " << OpName << "_beta = 0.0;\n";
-         out << "\t" << "BLAS::sgemm_(&" << OpName << "_transF, &" << OpName << "_transXcol, &" << OpName << "_m, &" << OpName << "_n, &" << OpName << "_k, &" << OpName << "_alpha, " << OpName << "_f, &" << OpName << "_m,\n";
-         out << "\t" << "\t" << OpName << "_xcol, &" << OpName << "_k, &" << OpName << "_beta, tensor_" << fNY << ", &" << OpName << "_m);\n";
-      } else {
-         size_t fgHeight = fAttrKernelShape[0] / fAttrGroup;
-         size_t fgWidth  = fAttrKernelShape[1] * fAttrKernelShape[2] * fAttrKernelShape[3];
-         if (fType == "float") {
-            out << "\t" << "float " << OpName << "_fg[" << fgHeight * fgWidth << "];\n";
+      if (fUseInt8) {
+         size_t k = fShapeW[1] * fAttrKernelShape[0] * fAttrKernelShape[1];
+         size_t npix = fShapeX[0] * fShapeY[2] * fShapeY[3];
+         if (fActivationScale > 0) {
+            out << "\t" << "float " << OpName << "_xscale = " << std::setprecision(std::numeric_limits<float>::max_digits10) << fActivationScale << ";\n";
+         } else {
+            out << "\t" << "float " << OpName << "_xscale = TMVA_SOFIE_KERNELS::absmax_f32(tensor_" << fNX << ", " << fShapeX[0] * fShapeX[1] * fShapeX[2] * fShapeX[3] << ") / 127.f;\n";
          }
-         size_t xgHeight = fShapeX[1] * fAttrKernelShape[2] * fAttrKernelShape[3] / fAttrGroup;
-         size_t xgWidth  = fShapeX[0] * fShapeY[2] * fShapeY[3];
-         if (fType == "float") {
-            out << "\t" << "float " << OpName << "_xg[" << xgHeight * xgWidth << "];\n";
-            out << "\t" << "float " << OpName << "_yg[" << fgHeight * xgWidth << "];\n";
+         // columns of xcol are contiguous, so xcol is the row major (npix x k) left operand, Y (m x npix) is its column major result
+         if (fUnsignedActivation) {
+            // the zero padding of xcol stays in the uint8 range
+            out << "\t" << "std::uint8_t " << OpName << "_xq[" << npix * fKPadded << "];\n";
+            out << "\t" << "TMVA_SOFIE_KERNELS::quantize_u8(" << OpName << "_xcol, " << npix << ", " << k << ", " << fKPadded << ", " << OpName << "_xscale, " << OpName << "_xq);\n";
+            out << "\t" << "TMVA_SOFIE_KERNELS::gemm_u8(" << npix << ", " << fShapeW[0] << ", " << fKPadded << ", " << OpName << "_xq, tensor_" << fNW
+                << ", tensor_" << fNW << "scale, " << OpName << "_xscale, 1.f, 0.f, nullptr, tensor_" << fNY << ", true);\n";
+         } else {
+            out << "\t" << "std::int8_t " << OpName << "_xq[" << npix * fKPadded << "];\n";
+            out << "\t" << "TMVA_SOFIE_KERNELS::quantize_s8(" << OpName << "_xcol, " << npix << ", " << k << ", " << fKPadded << ", " << OpName << "_xscale, " << OpName << "_xq);\n";
+            out << "\t" << "TMVA_SOFIE_KERNELS::gemm_s8(" << npix << ", " << fShapeW[0] << ", " << fKPadded << ", " << OpName << "_xq, tensor_" << fNW
+                << ", tensor_" << fNW << "sum, tensor_" << fNW << "scale, " << OpName << "_xscale, 1.f, 0.f, nullptr, tensor_" << fNY << ", true);\n";
          }
-         out << "\t" << "char " << OpName << "_transF  = 'N';\n";
-         out << "\t" << "char " << OpName << "_transXg = 'N';\n";
-         out << "\t" << "int " << OpName << "_m = " << fgHeight << ";\n";
-         out << "\t" << "int " << OpName << "_n = " << xgWidth << ";\n";
-         out << "\t" << "int " << OpName << "_k = " << fgWidth << ";\n";
-
+      } else {
          if (fType == "float") {
-            out << "\t" << "float " << OpName << "_alpha = 1.0;\n";
-            out << "\t" << "float " << OpName << "_beta  = 0.0;\n";
+            out << "\t" << "float ";
          }
-
-         out << "\t" << "for (size_t g = 0; g < " << fAttrGroup << "; g++) {\n";
-         out << "\t" << "\t" << "for (size_t h = 0; h < " << fgHeight << "; h++) {\n";
-         out << "\t" << "\t" << "\t" << "for (size_t w = 0; w < " << fgWidth << "; w++) {\n";
-         out << "\t" << "\t" << "\t" << "\t" << OpName << "_fg[h + w * " << fgHeight << "] = " << OpName << "_f[h + g * " << fgHeight << " + w * " << fAttrKernelShape[0] << "];\n";
-         out << "\t" << "\t" << "\t" << "}\n";
-         out << "\t" << "\t" << "}\n";
-         out << "\t" << "\t" << "for (size_t h = 0; h < " << xgHeight << "; h++) {\n";
-         out << "\t" << "\t" << "\t" << "for (size_t w = 0; w < " << xgWidth << "; w++) {\n";
-         out << "\t" << "\t" << "\t" << "\t" << OpName << "_xg[h + w * " << xgHeight << "] = " << OpName << "_xcol[h + g * " << xgHeight << " + w * " << fShapeX[1] * fAttrKernelShape[2] * fAttrKernelShape[3] << "];\n";
+         // convolution kernels
+         out << OpName << "_f[" << fShapeW[0] * fShapeW[1] * fAttrKernelShape[0] * fAttrKernelShape[1] << "] = {0};\n";
+         // vectorize the (dilated)convolution kernels into a matrix
+         out << "\t" << "for (std::size_t k = 0; k < " << fShapeW[0] << "; k++) {\n";
+         out << "\t" << "\t" << "for (std::size_t d = 0; d < " << fShapeW[1] << "; d++) {\n";
+         out << "\t" << "\t" << "\t" << "for (std::size_t h = 0; h < " << fShapeW[2] << "; h++) {\n";
+         out << "\t" << "\t" << "\t" << "\t" << "for (std::size_t w = 0; w < " << fShapeW[3] << "; w++) {\n";
+         out << "\t" << "\t" << "\t" << "\t" << "\t" << OpName <<  "_f[k + " << "(d * " << fAttrKernelShape[0] * fAttrKernelShape[1] << " + h * " << fAttrDilations[0] * fAttrKernelShape[1] << " + w * " << fAttrDilations[1] << ") * " << fShapeW[0] << "] = tensor_" << fNW << "[k * " << fShapeW[1] * fShapeW[2] * fShapeW[3] << " + d * " << fShapeW[2] * fShapeW[3] << " + h * " << fShapeW[3] << " + w ];\n";
+         out << "\t" << "\t" << "\t" << "\t" << "}\n";
          out << "\t" << "\t" << "\t" << "}\n";
          out << "\t" << "\t" << "}\n";
-         out << "\t" << "\t" << "BLAS::sgemm_(&" << OpName << "_transF, &" << OpName << "_transXg, &" << OpName << "_m, &" << OpName << "_n, &" << OpName << "_k, &" << OpName << "_alpha, " << OpName << "_fg, &" << OpName << "_m, " << OpName << "_xg, &" << OpName << "_k, &" << OpName << "_beta, " << OpName << "_yg, &" << OpName << "_m);\n";
-         out << "\t" << "\t" << "for (size_t i = 0; i < " << fgHeight * xgWidth << "; i++) {\n";
-         out << "\t" << "\t" << "\t" << "tensor_" << fNY << "[i + g * " << fgHeight * xgWidth << "] = " << OpName << "_yg[i];\n";
-         out << "\t" << "\t" << "}\n";
+         out << "\t" << "}\n";
+
+         // Y (m x npix, row major) is the column major npix x m product xcol^T f^T, one per group: the rows of xcol
+         // and of f of the channels of group g give its output channels
+         size_t mg = fShapeW[0] / fAttrGroup;
+         size_t kg = fShapeW[1] * fAttrKernelShape[0] * fAttrKernelShape[1];
+         size_t npix = fShapeX[0] * fShapeY[2] * fShapeY[3];
+         out << "\t" << "char " << OpName << "_transXcol = 'T';\n";
+         out << "\t" << "char " << OpName << "_transF = 'T';\n";
+         out << "\t" << "int " << OpName << "_m = " << npix << ";\n";
+         out << "\t" << "int " << OpName << "_n = " << mg << ";\n";
+         out << "\t" << "int " << OpName << "_k = " << kg << ";\n";
+         out << "\t" << "int " << OpName << "_ldxcol = " << fShapeX[1] * fAttrKernelShape[0] * fAttrKernelShape[1] << ";\n";
+         out << "\t" << "int " << OpName << "_ldf = " << fShapeW[0] << ";\n";
+         out << "\t" << "float " << OpName << "_alpha = 1.0;\n";
+         out << "\t" << "float " << OpName << "_beta = 0.0;\n";
+         out << "\t" << "for (size_t g = 0; g < " << fAttrGroup << "; g++) {\n";
+         out << "\t" << "\t" << "BLAS::sgemm_(&" << OpName << "_transXcol, &" << OpName << "_transF, &" << OpName << "_m, &" << OpName << "_n, &" << OpName << "_k, &" << OpName << "_alpha, "
+             << OpName << "_xcol + g * " << kg << ", &" << OpName << "_ldxcol,\n";
+         out << "\t" << "\t" << "\t" << OpName << "_f + g * " << mg << ", &" << OpName << "_ldf, &" << OpName << "_beta, tensor_" << fNY << " + g * " << mg * npix << ", &" << OpName << "_m);\n";
          out << "\t" << "}\n";
       }
 
@@ -3,13 +3,17 @@
 
 
 #include "SOFIE_common.hxx"
+#include "SOFIE_kernels.hxx"
 #include "ROperator.hxx"
 #include "RModel.hxx"
+#include "RInterpreter.hxx"
 
 #include <sstream>
 #include <algorithm>
 #include <iterator>
 #include <iomanip>
+#include <limits>
+#include <cmath>
 
 namespace TMVA{
 namespace Experimental{
@@ -34,9 +38,29 @@ namespace SOFIE{
       std::vector<size_t> fShapeB;
       std::vector<size_t> fShapeC;
       std::vector<size_t> fShapeY;
+      TensorId fIdA = 0;
+      TensorId fIdB = 0;
+      TensorId fIdC = 0;
+      TensorId fIdY = 0;
 
       std::string fType;
 
+      bool fUseInt8 = false;           //B quantized to int8 rows of length fKPadded, one per output column
+      size_t fKPadded = 0;
+      float fActivationScale = 0;      //int8 scale of A from calibration, 0 means computed at run time
+      bool fUnsignedActivation = false;   //A calibrated non negative, e.g. after a Relu, and quantized to uint8
+      ETensorType fHalfWeightType = ETensorType::UNDEFINED;   //FLOAT16 or BFLOAT16 when B is stored as 16 bit rows
+      bool fUseInt8Weights = false;    //B quantized to int8 rows, one per output column, A stays float
+      bool fUseSparse = false;         //B stored in CSR format, one row per output column
+      std::vector<float> fUnrolledValues;          //non zero weights emitted as literals for tiny layers
+      std::vector<std::int32_t> fUnrolledColIdx;
+      std::vector<std::int32_t> fUnrolledRowPtr;
+
+      bool fUseSparseInput = false;    //batch-1 layer skipping the weight rows of zero inputs, B stored k x n
+      int fSparseInputMaxNonZeros = 0;
+
+      static constexpr size_t kMaxUnrolledNonZeros = 256;
+
    public:
 
       ROperator_Gemm() = delete;
@@ -107,17 +131,20 @@ namespace SOFIE{
                throw std::runtime_error("TMVA SOFIE Gemm Op Input Tensor" + fNC + " is not found in model");
             }
          }
-         fShapeA = model.GetTensorShape(fNA);
+         fIdA = model.GetTensorId(fNA);
+         fIdB = model.GetTensorId(fNB);
+         fShapeA = model.GetTensorShape(fIdA);
          if (fShapeA.size() != 2){
             throw std::runtime_error("TMVA SOFIE Gemm Op Input Tensor" + fNA + " is not of 2 dimensions");
          }
-         fShapeB = model.GetTensorShape(fNB);
+         fShapeB = model.GetTensorShape(fIdB);
          if (fShapeB.size() != 2){
             throw std::runtime_error("TMVA SOFIE Gemm Op Input Tensor" + fNB + " is not of 2 dimensions");
          }
          fShapeY = ShapeInference({fShapeA, fShapeB})[0];
          if (fNC != ""){
-            fShapeC = model.GetTensorShape(fNC);
+            fIdC = model.GetTensorId(fNC);
+            fShapeC = model.GetTensorShape(fIdC);
 
             bool broadcast_needed = false;
             for (int i =0; i < fShapeC.size(); i++){
@@ -141,11 +168,375 @@ namespace SOFIE{
 
 
 
-         model.AddIntermediateTensor(fNY, model.GetTensorType(fNA), fShapeY);
+         if (fType == "float" && !fUseEigen && fAttrTransA == 0 && model.IsInitializedTensor(fIdB) && !model.UseOption(Options::kShapesOnly)){
+            if (model.UseOption(Options::kInt8)){
+               InitializeInt8(model);
+            }else if (model.UseOption(Options::kInt8Weights)){
+               InitializeInt8Weights(model);
+            }else if (model.UseOption(Options::kFloat16Weights) || model.UseOption(Options::kBFloat16Weights)){
+               InitializeHalfWeights(model, model.UseOption(Options::kFloat16Weights) ? ETensorType::FLOAT16 : ETensorType::BFLOAT16);
+            }else if (!model.UseOption(Options::kSwappableWeights)){   //the sparse layouts depend on the values of the weights
+               size_t length = fShapeB[0] * fShapeB[1];
+               //counted in place, B is only copied by a sparse layout
+               size_t zeros = UTILITY::CountZeroFloats(model.GetInitializedTensorBytes(fNB).get(), length);
+               if (static_cast<float>(zeros) / length > model.GetSparseWeightThreshold()){
+                  InitializeSparse(model);
+               }else if (fShapeA[0] == 1 && model.IsSparseInputLayer(fNB)){
+                  InitializeSparseInput(model);
+               }
+            }
+         }
+
+         model.AddIntermediateTensor(fNY, model.GetTensorType(fIdA), fShapeY);
+         fIdY = model.GetTensorId(fNY);
          model.AddNeededStdLib("algorithm");
 
       }
 
+      //a multiply and an add per term of the products, and the scaled bias
+      std::size_t GetFlops(){
+         std::size_t k = fAttrTransA ? fShapeA[0] : fShapeA[1];
+         return ConvertShapeToLength(fShapeY) * (2 * k + (fNC.empty() ? 0 : 2));
+      }
+
+      //the weights unrolled into the code of a tiny sparse layer are not tensors and are not counted
+      std::vector<std::string> GetInputTensorNames(){
+         std::vector<std::string> names = {fNA};
+         if (fUnrolledRowPtr.empty()) names.push_back(fNB);
+         if (fUseInt8 || fUseInt8Weights) names.push_back(fNB + "scale");
+         if (fUseInt8) names.push_back(fNB + "sum");
+         if (fUseSparse){
+            names.push_back(fNB + "colidx");
+            names.push_back(fNB + "rowptr");
+         }
+         if (!fNC.empty()) names.push_back(fNC);
+         return names;
+      }
+      std::vector<std::string> GetOutputTensorNames(){
+         return {fNY};
+      }
+      //A quantized by the int8 code
+      std::size_t GetScratchBytes(){
+         return fUseInt8 ? fShapeA[0] * fKPadded * sizeof(std::int8_t) : 0;
+      }
+
+      //Y = alpha * op(A) * op(B) + beta * C on float B, C already broadcast to the shape of Y by Initialize
+      void Forward_reference(RInterpreter& interpreter){
+         if (fUseInt8 || fUseInt8Weights || fUseSparse || fUseSparseInput || fHalfWeightType != ETensorType::UNDEFINED){
+            throw std::runtime_error("TMVA SOFIE Gemm Op " + fNY + " has converted weights and cannot be interpreted");
+         }
+         const T* A = interpreter.GetTensorData<T>(fIdA);
+         const T* B = interpreter.GetTensorData<T>(fIdB);
+         const T* C = (fNC != "" ? interpreter.GetTensorData<T>(fIdC) : nullptr);
+         T* Y = interpreter.GetTensorData<T>(fIdY);
+         size_t m = (fAttrTransA ? fShapeA[1] : fShapeA[0]);
+         size_t n = (fAttrTransB ? fShapeB[0] : fShapeB[1]);
+         size_t k = (fAttrTransA ? fShapeA[0] : fShapeA[1]);
+         for (size_t i = 0; i < m; i++){
+            T* y = Y + i * n;
+            for (size_t j = 0; j < n; j++){
+               y[j] = (C != nullptr ? fAttrBeta * C[i * n + j] : 0);
+            }
+            if (fAttrTransB){
+               //rows of B are contiguous along k: dot products with 8 partial sums, which the compiler vectorizes
+               const T* a = A + i * k;
+               if (fAttrTransA){
+                  T* column = interpreter.GetScratch(k);
+                  for (size_t p = 0; p < k; p++) column[p] = A[p * m + i];
+                  a = column;
+               }
+               for (size_t j = 0; j < n; j++){
+                  const T* b = B + j * k;
+                  T sums[8] = {0};
+                  size_t p = 0;
+                  for (; p + 8 <= k; p += 8){
+                     for (size_t l = 0; l < 8; l++) sums[l] += a[p + l] * b[p + l];
+                  }
+                  T sum = 0;
+                  for (; p < k; p++) sum += a[p] * b[p];
+                  for (size_t l = 0; l < 8; l++) sum += sums[l];
+                  y[j] += fAttrAlpha * sum;
+               }
+            }else{
+               for (size_t p = 0; p < k; p++){
+                  T a = fAttrAlpha * (fAttrTransA ? A[p * m + i] : A[i * k + p]);
+                  const T* b = B + p * n;
+                  for (size_t j = 0; j < n; j++){
+                     y[j] += a * b[j];
+                  }
+               }
+            }
+         }
+      }
+
+      std::string GetOpType(){
+         return "Gemm";
+      }
+
+      OperatorRecord GetRecord(){
+         OperatorRecord record;
+         record.op_type = GetOpType();
+         record.tensors = {fNA, fNB, fNC, fNY};
+         record.ints = {{fAttrTransA, fAttrTransB}};
+         record.floats = {fAttrAlpha, fAttrBeta};
+         return record;
+      }
+
+      //B as one row per output column, so that the reduced precision kernels reduce over contiguous memory
+      std::vector<float> GetWeightRows(RModel& model){
+         size_t n = (fAttrTransB ? fShapeB[0] : fShapeB[1]);
+         size_t k = (fAttrTransB ? fShapeB[1] : fShapeB[0]);
+         if (model.GetTensorType(fNB) != ETensorType::FLOAT){
+            throw std::runtime_error("TMVA SOFIE Gemm Op weight tensor " + fNB + " is already converted to " + ConvertTypeToString(model.GetTensorType(fNB)));
+         }
+         const float* original_data = static_cast<float*>(model.GetInitializedTensorData(fNB).get());
+         std::vector<float> rows(n * k);
+         for (size_t i = 0; i < n; i++){
+            for (size_t j = 0; j < k; j++){
+               rows[i * k + j] = (fAttrTransB ? original_data[i * k + j] : original_data[j * n + i]);
+            }
+         }
+         return rows;
+      }
+
+      //stores a converted copy of B: in place when no other operator reads B, otherwise under a name of this operator so
+      //that the others still find the float weights. fNB names the copy from then on
+      void StoreConvertedWeight(RModel& model, ETensorType type, std::vector<size_t> shape, std::shared_ptr<void> data){
+         if (model.IsReadByOtherOperators(fNB)){
+            model.ReleaseTensor(fNB);
+            fNB = fNB + "for" + fNY;   //tensor names are alphanumeric
+            model.AddInitializedTensor(fNB, type, std::move(shape), std::move(data));
+         }else{
+            model.UpdateInitializedTensor(fNB, type, std::move(shape), std::move(data));
+         }
+         fIdB = model.GetTensorId(fNB);
+      }
+
+      void InitializeInt8(RModel& model){
+         size_t n = (fAttrTransB ? fShapeB[0] : fShapeB[1]);
+         size_t k = (fAttrTransB ? fShapeB[1] : fShapeB[0]);
+         fKPadded = (k + KERNELS::kInt8RowAlignment - 1) / KERNELS::kInt8RowAlignment * KERNELS::kInt8RowAlignment;
+         std::vector<float> rows = GetWeightRows(model);
+         std::shared_ptr<void> quantized(malloc(n * fKPadded * sizeof(std::int8_t)), free);
+         std::shared_ptr<void> scales(malloc(n * sizeof(float)), free);
+         std::shared_ptr<void> sums(malloc(n * sizeof(std::int32_t)), free);
+         UTILITY::QuantizeRowsInt8(rows.data(), n, k, fKPadded, static_cast<std::int8_t*>(quantized.get()),
+                                   static_cast<float*>(scales.get()), static_cast<std::int32_t*>(sums.get()));
+         std::vector<float> dequantized(n * k);
+         for (size_t i = 0; i < n; i++){
+            for (size_t j = 0; j < k; j++){
+               dequantized[i * k + j] = static_cast<std::int8_t*>(quantized.get())[i * fKPadded + j] * static_cast<float*>(scales.get())[i];
+            }
+         }
+         StoreConvertedWeight(model, ETensorType::INT8, {n, fKPadded}, quantized);
+         model.AddWeightConversionInfo(fNB, ETensorType::INT8, rows.data(), dequantized.data(), n * k);
+         model.AddInitializedTensor(fNB + "scale", ETensorType::FLOAT, {n}, scales);
+         model.AddInitializedTensor(fNB + "sum", ETensorType::INT32, {n}, sums);
+
+         float min, max;
+         if (model.GetActivationRange(fNA, min, max)){
+            fUnsignedActivation = min >= 0;
+            fActivationScale = fUnsignedActivation ? max / 255.f : std::max(std::fabs(min), std::fabs(max)) / 127.f;
+            if (!(fActivationScale > 0)) fActivationScale = 1.f;   //constant zero input
+         }
+         fUseInt8 = true;
+      }
+
+      void InitializeInt8Weights(RModel& model){
+         size_t n = (fAttrTransB ? fShapeB[0] : fShapeB[1]);
+         size_t k = (fAttrTransB ? fShapeB[1] : fShapeB[0]);
+         std::vector<float> rows = GetWeightRows(model);
+         std::shared_ptr<void> quantized(malloc(n * k * sizeof(std::int8_t)), free);
+         std::shared_ptr<void> scales(malloc(n * sizeof(float)), free);
+         std::vector<std::int32_t> sums(n);
+         UTILITY::QuantizeRowsInt8(rows.data(), n, k, k, static_cast<std::int8_t*>(quantized.get()), static_cast<float*>(scales.get()), sums.data());
+         std::vector<float> dequantized(n * k);
+         for (size_t i = 0; i < n * k; i++){
+            dequantized[i] = static_cast<std::int8_t*>(quantized.get())[i] * static_cast<float*>(scales.get())[i / k];
+         }
+         StoreConvertedWeight(model, ETensorType::INT8, {n, k}, quantized);
+         model.AddWeightConversionInfo(fNB, ETensorType::INT8, rows.data(), dequantized.data(), n * k);
+         model.AddInitializedTensor(fNB + "scale", ETensorType::FLOAT, {n}, scales);
+         fUseInt8Weights = true;
+      }
+
+      void InitializeSparse(RModel& model){
+         size_t n = (fAttrTransB ? fShapeB[0] : fShapeB[1]);
+         size_t k = (fAttrTransB ? fShapeB[1] : fShapeB[0]);
+         std::vector<float> rows = GetWeightRows(model);
+         std::vector<float> values;
+         std::vector<std::int32_t> colidx;
+         std::vector<std::int32_t> rowptr(1, 0);
+         for (size_t i = 0; i < n; i++){
+            for (size_t j = 0; j < k; j++){
+               if (rows[i * k + j] != 0){
+                  values.push_back(rows[i * k + j]);
+                  colidx.push_back(j);
+               }
+            }
+            rowptr.push_back(values.size());
+         }
+         fUseSparse = true;
+         if (values.size() <= kMaxUnrolledNonZeros){
+            fUnrolledValues = values;
+            fUnrolledColIdx = colidx;
+            fUnrolledRowPtr = rowptr;
+            if (model.IsReadByOtherOperators(fNB)){
+               model.ReleaseTensor(fNB);
+            }else{
+               model.RemoveInitializedTensor(fNB);
+            }
+            return;
+         }
+         if (values.empty()){   //keep a valid array, the kernel never reads it
+            values.push_back(0);
+            colidx.push_back(0);
+         }
+         std::shared_ptr<void> values_data(malloc(values.size() * sizeof(float)), free);
+         std::shared_ptr<void> colidx_data(malloc(colidx.size() * sizeof(std::int32_t)), free);
+         std::shared_ptr<void> rowptr_data(malloc(rowptr.size() * sizeof(std::int32_t)), free);
+         std::copy(values.begin(), values.end(), static_cast<float*>(values_data.get()));
+         std::copy(colidx.begin(), colidx.end(), static_cast<std::int32_t*>(colidx_data.get()));
+         std::copy(rowptr.begin(), rowptr.end(), static_cast<std::int32_t*>(rowptr_data.get()));
+         StoreConvertedWeight(model, ETensorType::FLOAT, {values.size()}, values_data);
+         model.AddInitializedTensor(fNB + "colidx", ETensorType::INT32, {colidx.size()}, colidx_data);
+         model.AddInitializedTensor(fNB + "rowptr", ETensorType::INT32, {rowptr.size()}, rowptr_data);
+      }
+
+      void InitializeSparseInput(RModel& model){
+         if (fAttrTransB){   //the kernel streams one row of B per non zero input
+            size_t n = fShapeB[0];
+            size_t k = fShapeB[1];
+            const float* original_data = static_cast<float*>(model.GetInitializedTensorData(fNB).get());
+            std::shared_ptr<void> transposed(malloc(n * k * sizeof(float)), free);
+            for (size_t i = 0; i < n; i++){
+               for (size_t j = 0; j < k; j++){
+                  static_cast<float*>(transposed.get())[j * n + i] = original_data[i * k + j];
+               }
+            }
+            fShapeB = {k, n};
+            fAttrTransB = 0;
+            StoreConvertedWeight(model, ETensorType::FLOAT, fShapeB, transposed);
+         }
+         fSparseInputMaxNonZeros = static_cast<int>(model.GetSparseInputDensity() * fShapeB[0]);
+         fUseSparseInput = true;
+      }
+
+      void InitializeHalfWeights(RModel& model, ETensorType type){
+         size_t n = (fAttrTransB ? fShapeB[0] : fShapeB[1]);
+         size_t k = (fAttrTransB ? fShapeB[1] : fShapeB[0]);
+         std::vector<float> rows = GetWeightRows(model);
+         std::shared_ptr<void> converted(malloc(n * k * sizeof(std::uint16_t)), free);
+         std::uint16_t* converted_data = static_cast<std::uint16_t*>(converted.get());
+         std::vector<float> roundtrip(n * k);
+         for (size_t i = 0; i < n * k; i++){
+            if (type == ETensorType::FLOAT16){
+               converted_data[i] = UTILITY::ConvertFloatToHalf(rows[i]);
+               roundtrip[i] = UTILITY::ConvertHalfToFloat(converted_data[i]);
+            }else{
+               converted_data[i] = UTILITY::ConvertFloatToBFloat16(rows[i]);
+               roundtrip[i] = UTILITY::ConvertBFloat16ToFloat(converted_data[i]);
+            }
+         }
+         StoreConvertedWeight(model, type, {n, k}, converted);
+         model.AddWeightConversionInfo(fNB, type, rows.data(), roundtrip.data(), n * k);
+         fHalfWeightType = type;
+      }
+
+      std::string Header(){
+         if (fUseInt8) return KERNELS::Int8Gemm();
+         if (fHalfWeightType != ETensorType::UNDEFINED) return KERNELS::HalfWeightGemm();
+         if (fUseInt8Weights) return KERNELS::Int8WeightGemm();
+         if (fUseSparse && fUnrolledRowPtr.empty()) return KERNELS::SparseGemm();
+         if (fUseSparseInput) return KERNELS::SparseInputGemv();
+         return "";
+      }
+
+      std::string GenerateInt8Weights(std::string OpName){
+         std::stringstream out;
+         int m = fShapeA[0];
+         int n = (fAttrTransB ? fShapeB[0] : fShapeB[1]);
+         int k = fShapeA[1];
+         out << "\t" << "float " << OpName << "_alpha = " << std::setprecision(std::numeric_limits<float>::max_digits10) << fAttrAlpha << ";\n";
+         out << "\t" << "float " << OpName << "_beta = " << std::setprecision(std::numeric_limits<float>::max_digits10) << fAttrBeta << ";\n";
+         out << "\t" << "TMVA_SOFIE_KERNELS::gemm_s8w(" << m << ", " << n << ", " << k << ", tensor_" << fNA << ", tensor_" << fNB << ", tensor_" << fNB << "scale, "
+             << OpName << "_alpha, " << OpName << "_beta, " << (fNC != "" ? "tensor_" + fNC : "nullptr") << ", tensor_" << fNY << ");\n";
+         return out.str();
+      }
+
+      std::string GenerateSparse(std::string OpName){
+         std::stringstream out;
+         int m = fShapeA[0];
+         int n = (fAttrTransB ? fShapeB[0] : fShapeB[1]);
+         int k = fShapeA[1];
+         out << std::setprecision(std::numeric_limits<float>::max_digits10);
+         out << "\t" << "float " << OpName << "_alpha = " << fAttrAlpha << ";\n";
+         out << "\t" << "float " << OpName << "_beta = " << fAttrBeta << ";\n";
+         out << std::showpoint;   //keep a decimal point so that the literals can take the f suffix
+         if (fUnrolledRowPtr.empty()){
+            out << "\t" << "TMVA_SOFIE_KERNELS::gemm_csr(" << m << ", " << n << ", " << k << ", tensor_" << fNA << ", tensor_" << fNB << ", tensor_" << fNB << "colidx, tensor_"
+                << fNB << "rowptr, " << OpName << "_alpha, " << OpName << "_beta, " << (fNC != "" ? "tensor_" + fNC : "nullptr") << ", tensor_" << fNY << ");\n";
+            return out.str();
+         }
+         //tiny layer: one unrolled dot product per output with the non zero weights as literals
+         out << "\t" << "for (int " << OpName << "_i = 0; " << OpName << "_i < " << m << "; " << OpName << "_i++){\n";
+         out << "\t\t" << "const float* " << OpName << "_a = tensor_" << fNA << " + " << OpName << "_i * " << k << ";\n";
+         for (int j = 0; j < n; j++){
+            out << "\t\t" << "tensor_" << fNY << "[" << OpName << "_i * " << n << " + " << j << "] = " << OpName << "_alpha * (0.f";
+            for (std::int32_t p = fUnrolledRowPtr[j]; p < fUnrolledRowPtr[j + 1]; p++){
+               out << " + " << fUnrolledValues[p] << "f * " << OpName << "_a[" << fUnrolledColIdx[p] << "]";
+            }
+            out << ")";
+            if (fNC != "") out << " + " << OpName << "_beta * tensor_" << fNC << "[" << OpName << "_i * " << n << " + " << j << "]";
+            out << ";\n";
+         }
+         out << "\t}\n";
+         return out.str();
+      }
+
+      std::string GenerateHalfWeights(std::string OpName){
+         std::stringstream out;
+         int m = fShapeA[0];
+         int n = (fAttrTransB ? fShapeB[0] : fShapeB[1]);
+         int k = fShapeA[1];
+         out << "\t" << "float " << OpName << "_alpha = " << std::setprecision(std::numeric_limits<float>::max_digits10) << fAttrAlpha << ";\n";
+         out << "\t" << "float " << OpName << "_beta = " << std::setprecision(std::numeric_limits<float>::max_digits10) << fAttrBeta << ";\n";
+         out << "\t" << "TMVA_SOFIE_KERNELS::gemm_f16w(" << m << ", " << n << ", " << k << ", tensor_" << fNA << ", tensor_" << fNB << ", "
+             << (fHalfWeightType == ETensorType::BFLOAT16 ? "true" : "false") << ", " << OpName << "_alpha, " << OpName << "_beta, "
+             << (fNC != "" ? "tensor_" + fNC : "nullptr") << ", tensor_" << fNY << ");\n";
+         return out.str();
+      }
+
+      std::string GenerateInt8(std::string OpName){
+         std::stringstream out;
+         int m = fShapeA[0];
+         int n = (fAttrTransB ? fShapeB[0] : fShapeB[1]);
+         int k = fShapeA[1];
+         out << "\t" << "float " << OpName << "_alpha = " << std::setprecision(std::numeric_limits<float>::max_digits10) << fAttrAlpha << ";\n";
+         out << "\t" << "float " << OpName << "_beta = " << std::setprecision(std::numeric_limits<float>::max_digits10) << fAttrBeta << ";\n";
+         if (fActivationScale > 0){
+            out << "\t" << "float " << OpName << "_ascale = " << std::setprecision(std::numeric_limits<float>::max_digits10) << fActivationScale << ";\n";
+         }else{
+            out << "\t" << "float " << OpName << "_ascale = TMVA_SOFIE_KERNELS::absmax_f32(tensor_" << fNA << ", " << m * k << ") / 127.f;\n";
+         }
+         if (fUnsignedActivation){
+            out << "\t" << "std::uint8_t " << OpName << "_aq[" << m * fKPadded << "];\n";
+            out << "\t" << "TMVA_SOFIE_KERNELS::quantize_u8(tensor_" << fNA << ", " << m << ", " << k << ", " << fKPadded << ", "
+                << OpName << "_ascale, " << OpName << "_aq);\n";
+            out << "\t" << "TMVA_SOFIE_KERNELS::gemm_u8(" << m << ", " << n << ", " << fKPadded << ", " << OpName << "_aq, tensor_" << fNB
+                << ", tensor_" << fNB << "scale, " << OpName << "_ascale, " << OpName << "_alpha, " << OpName << "_beta, "
+                << (fNC != "" ? "tensor_" + fNC : "nullptr") << ", tensor_" << fNY << ");\n";
+            return out.str();
+         }
+         out << "\t" << "std::int8_t " << OpName << "_aq[" << m * fKPadded << "];\n";
+         out << "\t" << "TMVA_SOFIE_KERNELS::quantize_s8(tensor_" << fNA << ", " << m << ", " << k << ", " << fKPadded << ", "
+             << OpName << "_ascale, " << OpName << "_aq);\n";
+         out << "\t" << "TMVA_SOFIE_KERNELS::gemm_s8(" << m << ", " << n << ", " << fKPadded << ", " << OpName << "_aq, tensor_" << fNB
+             << ", tensor_" << fNB << "sum, tensor_" << fNB << "scale, " << OpName << "_ascale, " << OpName << "_alpha, " << OpName << "_beta, "
+             << (fNC != "" ? "tensor_" + fNC : "nullptr") << ", tensor_" << fNY << ");\n";
+         return out.str();
+      }
+
 
 
       std::string Generate(std::string OpName){
@@ -153,6 +544,46 @@ namespace SOFIE{
          if (fShapeA.empty() || fShapeB.empty() || fShapeY.empty() || (fNC != "" && fShapeC.empty())){
             throw std::runtime_error("TMVA SOFIE Gemm Op called to Generate without being initialized first");
          }
+         if (fUseInt8){
+            return GenerateInt8(OpName);
+         }
+         if (fHalfWeightType != ETensorType::UNDEFINED){
+            return GenerateHalfWeights(OpName);
+         }
+         if (fUseInt8Weights){
+            return GenerateInt8Weights(OpName);
+         }
+         if (fUseSparse){
+            return GenerateSparse(OpName);
+         }
+         if (fUseSparseInput){
+            return GenerateSparseInput(OpName);
+         }
+         return GenerateDense(OpName);
+      }
+
+      //input density is checked at run time, dense inputs fall back to the BLAS code
+      std::string GenerateSparseInput(std::string OpName){
+         std::stringstream out;
+         int n = fShapeB[1];
+         int k = fShapeB[0];
+         std::string dense = GenerateDense(OpName);
+         size_t pos = 0;
+         while ((pos = dense.find("\n\t", pos)) != std::string::npos){
+            dense.insert(pos + 1, "\t");
+            pos += 2;
+         }
+         out << "\t" << "if (TMVA_SOFIE_KERNELS::count_nonzero(tensor_" << fNA << ", " << k << ") <= " << fSparseInputMaxNonZeros << "){\n";
+         out << "\t\t" << "TMVA_SOFIE_KERNELS::gemv_sparse_x(" << n << ", " << k << ", tensor_" << fNA << ", tensor_" << fNB << ", "
+             << std::setprecision(std::numeric_limits<float>::max_digits10) << std::showpoint << fAttrAlpha << "f, " << fAttrBeta << "f, "
+             << (fNC != "" ? "tensor_" + fNC : "nullptr") << ", tensor_" << fNY << ");\n";
+         out << "\t" << "}else{\n";
+         out << "\t" << dense;
+         out << "\t" << "}\n";
+         return out.str();
+      }
+
+      std::string GenerateDense(std::string OpName){
          std::stringstream out;
 
          int f_m = (fAttrTransA ? fShapeA[1] : fShapeA[0]);
@@ -210,10 +641,9 @@ namespace SOFIE{
                int m;
                int n;
                if (f_m == 1){
-                  m = (fAttrTransB ? fShapeB[1] : fShapeB[0]);
-                  n = (fAttrTransB ? fShapeB[0] : fShapeB[1]);
-                  //m = fShapeB[1];
-                  //n = fShapeB[0];
+                  //row major B is seen by BLAS as a column major fShapeB[1] x fShapeB[0] matrix, whatever transB is
+                  m = fShapeB[1];
+                  n = fShapeB[0];
                   fAttrTransB = 1 - fAttrTransB;
                   out <<"\t" << "char " << OpName << "_trans = " << (fAttrTransB ? "\'n\'" : "\'t\'") << ";\n";
                   out <<"\t" << "int " << OpName << "_lda = " << fShapeB[1] << ";\n";
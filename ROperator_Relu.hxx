@@ -4,6 +4,7 @@
 #include "SOFIE_common.hxx"
 #include "ROperator.hxx"
 #include "RModel.hxx"
+#include "RInterpreter.hxx"
 
 #include <sstream>
 
@@ -20,6 +21,8 @@ private:
    std::string fNX;
    std::string fNY;
    std::vector<size_t> fShape;
+   TensorId fIdX = 0;
+   TensorId fIdY = 0;
 
 public:
    ROperator_Relu() = delete;
@@ -39,10 +42,43 @@ public:
       if (model.CheckIfTensorAlreadyExist(fNX) == false){   //input must be a graph input, or already initialized intermediate tensor
          throw std::runtime_error("TMVA SOFIE Relu Op Input Tensor is not found in model");
       }
-      fShape = model.GetTensorShape(fNX);
-      model.AddIntermediateTensor(fNY, model.GetTensorType(fNX), fShape);
+      fIdX = model.GetTensorId(fNX);
+      fShape = model.GetTensorShape(fIdX);
+      model.AddIntermediateTensor(fNY, model.GetTensorType(fIdX), fShape);
+      fIdY = model.GetTensorId(fNY);
    }
 
+   std::size_t GetFlops(){
+      return ConvertShapeToLength(fShape);
+   }
+
+   std::vector<std::string> GetInputTensorNames(){
+      return {fNX};
+   }
+   std::vector<std::string> GetOutputTensorNames(){
+      return {fNY};
+   }
+
+   void Forward_reference(RInterpreter& interpreter){
+      const T* x = interpreter.GetTensorData<T>(fIdX);
+      T* y = interpreter.GetTensorData<T>(fIdY);
+      size_t length = ConvertShapeToLength(fShape);
+      for (size_t id = 0; id < length; id++){
+         y[id] = (x[id] > 0) ? x[id] : 0;
+      }
+   }
+
+
+   std::string GetOpType(){
+      return "Relu";
+   }
+
+   OperatorRecord GetRecord(){
+      OperatorRecord record;
+      record.op_type = GetOpType();
+      record.tensors = {fNX, fNY};
+      return record;
+   }
 
    std::string Generate(std::string OpName){
       OpName = "op_" + OpName;
@@ -4,6 +4,7 @@
 #include "SOFIE_common.hxx"
 #include "ROperator.hxx"
 #include "RModel.hxx"
+#include "RInterpreter.hxx"
 
 #include <sstream>
 
@@ -25,6 +26,8 @@ private:
    std::string fNOutput;
    std::vector<size_t> fShapeData;
    std::vector<size_t> fShapeOutput;
+   TensorId fIdData = 0;
+   TensorId fIdOutput = 0;
 
 public:
 
@@ -44,9 +47,10 @@ public:
    std::vector<std::vector<size_t>> ShapeInference(std::vector<std::vector<size_t>> input){
       if (input.size() > 1) throw std::runtime_error("TMVA SOFIE Tranpose Op Shape Inference only need 1 input tensor");
       auto& data = input[0];
+      //output dimension i is input dimension fAttrPerm[i], as in ONNX
       std::vector<size_t> output_shape(fAttrPerm.size());
       for (int i = 0; i < fAttrPerm.size(); i++){
-         output_shape[fAttrPerm[i]] = data[i];
+         output_shape[i] = data[fAttrPerm[i]];
       }
       std::vector<std::vector<size_t>> ret;
       ret.push_back(output_shape);
@@ -58,22 +62,66 @@ public:
       if (model.CheckIfTensorAlreadyExist(fNData) == false){   //input must be a graph input, or already initialized intermediate tensor
          throw std::runtime_error("TMVA SOFIE Tranpose Op Input Tensor is not found in model");
       }
-      fShapeData = model.GetTensorShape(fNData);
+      fIdData = model.GetTensorId(fNData);
+      fShapeData = model.GetTensorShape(fIdData);
       if (fAttrPerm.empty()){
          for (int i = fShapeData.size() - 1; i >= 0; i--){
             fAttrPerm.push_back(i);
          }
       }
 
-      std::vector<size_t> output_shape(fAttrPerm.size());
-      for (int i = 0; i < fAttrPerm.size(); i++){
-         output_shape[fAttrPerm[i]] = fShapeData[i];
-      }
+      std::vector<size_t> output_shape = ShapeInference({fShapeData})[0];
 
-      model.AddIntermediateTensor(fNOutput, model.GetTensorType(fNData), output_shape);
+      model.AddIntermediateTensor(fNOutput, model.GetTensorType(fIdData), output_shape);
+      fIdOutput = model.GetTensorId(fNOutput);
       fShapeOutput = output_shape;
    }
 
+   std::vector<std::string> GetInputTensorNames(){
+      return {fNData};
+   }
+   std::vector<std::string> GetOutputTensorNames(){
+      return {fNOutput};
+   }
+
+   void Forward_reference(RInterpreter& interpreter){
+      const T* data = interpreter.GetTensorData<T>(fIdData);
+      T* output = interpreter.GetTensorData<T>(fIdOutput);
+      int dim = fShapeData.size();
+      //stride in the output of every input dimension
+      std::vector<size_t> output_stride(dim);
+      size_t t = 1;
+      for (int i = dim - 1; i >= 0; i--){
+         output_stride[fAttrPerm[i]] = t;   //input dimension fAttrPerm[i] of the output dimension i
+         t *= fShapeOutput[i];
+      }
+      std::vector<size_t> index(dim, 0);
+      size_t length = ConvertShapeToLength(fShapeData);
+      size_t offset = 0;
+      for (size_t id = 0; id < length; id++){
+         output[offset] = data[id];
+         //odometer over the input index, keeping the output offset in step
+         for (int i = dim - 1; i >= 0; i--){
+            offset += output_stride[i];
+            if (++index[i] < fShapeData[i]) break;
+            offset -= output_stride[i] * fShapeData[i];
+            index[i] = 0;
+         }
+      }
+   }
+
+   std::string GetOpType(){
+      return "Transpose";
+   }
+
+   OperatorRecord GetRecord(){
+      OperatorRecord record;
+      record.op_type = GetOpType();
+      record.tensors = {fNData, fNOutput};
+      record.ints = {fAttrPerm};
+      return record;
+   }
+
    std::string Generate(std::string OpName){
       OpName = "op_" + OpName;
       if (fShapeData.empty() || fShapeOutput.empty()){
@@ -0,0 +1,113 @@
+#include "RPerfCounters.hxx"
+
+#include <cerrno>
+#include <cstring>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace TMVA{
+namespace Experimental{
+namespace SOFIE{
+
+const char* RPerfCounters::GetName(int counter){
+   static const char* names[kNumCounters] = {"cycles", "instructions", "L1d-misses", "LLC-misses", "dTLB-misses",
+                                             "branch-misses", "page-faults"};
+   return names[counter];
+}
+
+#if defined(__linux__)
+
+namespace{
+
+std::uint64_t CacheMiss(std::uint64_t cache){
+   return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+}
+
+}//anonymous namespace
+
+RPerfCounters::RPerfCounters(){
+   const std::uint32_t types[kNumCounters] = {PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE, PERF_TYPE_HW_CACHE,
+                                              PERF_TYPE_HW_CACHE, PERF_TYPE_HARDWARE, PERF_TYPE_SOFTWARE};
+   const std::uint64_t configs[kNumCounters] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, CacheMiss(PERF_COUNT_HW_CACHE_L1D),
+                                                CacheMiss(PERF_COUNT_HW_CACHE_LL), CacheMiss(PERF_COUNT_HW_CACHE_DTLB),
+                                                PERF_COUNT_HW_BRANCH_MISSES, PERF_COUNT_SW_PAGE_FAULTS};
+   //cycles and instructions usually have fixed counters, the rest fits in the general purpose ones of a core with HT
+   const int groups[kNumCounters] = {0, 0, 1, 1, 1, 0, 2};
+   for (int i = 0; i < kNumCounters; i++) fDescriptors[i] = -1;
+   for (int g = 0; g < 3; g++){
+      std::vector<int> group;
+      for (int i = 0; i < kNumCounters; i++){
+         if (groups[i] != g) continue;
+         perf_event_attr attr;
+         std::memset(&attr, 0, sizeof(attr));
+         attr.size = sizeof(attr);
+         attr.type = types[i];
+         attr.config = configs[i];
+         attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+         attr.exclude_kernel = 1;
+         attr.exclude_hv = 1;
+         //this thread on any CPU, the first counter opened leads the group
+         fDescriptors[i] = syscall(__NR_perf_event_open, &attr, 0, -1, group.empty() ? -1 : fDescriptors[group[0]], 0);
+         if (fDescriptors[i] < 0){
+            if (fError.empty()) fError = std::string(GetName(i)) + ": " + std::strerror(errno);
+            continue;
+         }
+         group.push_back(i);
+      }
+      if (group.empty()) continue;
+      //a group the PMU has no room for is never scheduled and would read 0
+      for (volatile int spin = 0; spin < 100000; spin = spin + 1);
+      std::uint64_t buffer[3 + kNumCounters];
+      if (read(fDescriptors[group[0]], buffer, sizeof(buffer)) <= 0 || buffer[2] == 0){
+         if (fError.empty()) fError = std::string(GetName(group[0])) + ": not scheduled, the PMU counters are in use";
+         for (auto it = group.rbegin(); it != group.rend(); ++it){
+            close(fDescriptors[*it]);
+            fDescriptors[*it] = -1;
+         }
+         continue;
+      }
+      fGroups.push_back(group);
+   }
+}
+
+RPerfCounters::~RPerfCounters(){
+   //the members of a group before its leader
+   for (auto& group: fGroups){
+      for (auto it = group.rbegin(); it != group.rend(); ++it) close(fDescriptors[*it]);
+   }
+}
+
+void RPerfCounters::Read(std::uint64_t* values) const {
+   std::memset(values, 0, kNumCounters * sizeof(std::uint64_t));
+   for (auto& group: fGroups){
+      //the number of counters, the times enabled and running, then their values
+      std::uint64_t buffer[3 + kNumCounters];
+      if (read(fDescriptors[group[0]], buffer, sizeof(buffer)) <= 0 || buffer[2] == 0) continue;
+      double scale = buffer[2] < buffer[1] ? static_cast<double>(buffer[1]) / buffer[2] : 1.;
+      for (std::size_t i = 0; i < group.size() && i < buffer[0]; i++){
+         values[group[i]] = scale == 1. ? buffer[3 + i] : static_cast<std::uint64_t>(buffer[3 + i] * scale);
+      }
+   }
+}
+
+#else
+
+RPerfCounters::RPerfCounters(): fError("hardware counters need Linux perf_event_open"){
+   for (int i = 0; i < kNumCounters; i++) fDescriptors[i] = -1;
+}
+
+RPerfCounters::~RPerfCounters(){}
+
+void RPerfCounters::Read(std::uint64_t* values) const {
+   std::memset(values, 0, kNumCounters * sizeof(std::uint64_t));
+}
+
+#endif
+
+}//SOFIE
+}//Experimental
+}//TMVA
@@ -0,0 +1,67 @@
+#ifndef TMVA_SOFIE_RPERFCOUNTERS
+#define TMVA_SOFIE_RPERFCOUNTERS
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace TMVA{
+namespace Experimental{
+namespace SOFIE{
+
+//hardware and kernel counters of the calling thread, opened as perf_event_open groups small enough for the PMU (the
+//cycle, instruction and branch counters, the cache misses, the software counter) and read with one system call each.
+//Only user space is counted, which perf_event_paranoid 2 allows. A counter the CPU or the kernel does not provide, e.g.
+//in a virtual machine without PMU, or whose group the PMU never schedules, e.g. when the NMI watchdog holds a counter,
+//is unavailable and reads 0; elsewhere than on Linux none is available. Groups multiplexed with other events are
+//scaled by the time they were enabled over the time they ran
+class RPerfCounters{
+
+public:
+
+   enum ECounter { kCycles, kInstructions, kL1DMisses, kLLCMisses, kDTLBMisses, kBranchMisses, kPageFaults, kNumCounters };
+
+private:
+
+   int fDescriptors[kNumCounters];       //-1 for an unavailable counter
+   std::vector<std::vector<int>> fGroups;   //counters of every open group in the order of its values, the leader first
+   std::string fError;                   //why the first unavailable counter could not be used
+
+public:
+
+   RPerfCounters();
+   ~RPerfCounters();
+
+   //disallow copy, the descriptors are closed with the object
+   RPerfCounters(const RPerfCounters& other) = delete;
+   RPerfCounters& operator=(const RPerfCounters& other) = delete;
+
+   static const char* GetName(int counter);
+   bool IsAvailable(int counter) const {
+      return fDescriptors[counter] >= 0;
+   }
+   bool AnyAvailable() const {
+      return !fGroups.empty();
+   }
+   const std::string& GetError() const {
+      return fError;
+   }
+
+   //kNumCounters running totals, to be subtracted from those of a later read
+   void Read(std::uint64_t* values) const;
+   std::vector<std::uint64_t> Read() const {
+      std::vector<std::uint64_t> values(kNumCounters);
+      Read(values.data());
+      return values;
+   }
+   //Read with the signature of the counter reader of the code generated with Options::kProfile
+   static void Read(void* counters, std::uint64_t* values){
+      static_cast<const RPerfCounters*>(counters)->Read(values);
+   }
+};
+
+}//SOFIE
+}//Experimental
+}//TMVA
+
+#endif //TMVA_SOFIE_RPERFCOUNTERS
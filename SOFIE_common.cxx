@@ -1,5 +1,16 @@
 #include "SOFIE_common.hxx"
 #include <cctype>
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+#include <stdexcept>
+#include <cstdio>
+#include <cstdlib>
+#if __cplusplus >= 201703L && defined(__has_include)
+#if __has_include(<charconv>)
+#include <charconv>
+#endif
+#endif
 
 namespace TMVA{
 namespace Experimental{
@@ -13,7 +24,7 @@ std::vector<Dim> ConvertShapeToDim(std::vector<size_t> shape){
    return fshape;
 }
 
-std::size_t ConvertShapeToLength(std::vector<size_t> shape){
+std::size_t ConvertShapeToLength(const std::vector<size_t>& shape){
    std::size_t fLength = 1;
    for (auto& dim: shape) fLength *= dim;
    return fLength;
@@ -24,12 +35,42 @@ std::string ConvertTypeToString(ETensorType type){
       case ETensorType::FLOAT : {
          return "float";
       }
+      case ETensorType::INT8 : {
+         return "int8_t";
+      }
+      case ETensorType::UNINT8 : {
+         return "uint8_t";
+      }
+      case ETensorType::INT32 : {
+         return "int32_t";
+      }
+      case ETensorType::INT64 : {
+         return "int64_t";
+      }
+      case ETensorType::FLOAT16 : {
+         return "float16";
+      }
+      case ETensorType::BFLOAT16 : {
+         return "bfloat16";
+      }
       default:{
          return "other";
       }
    }
 }
 
+std::size_t GetTypeSize(ETensorType type){
+   switch(type){
+      case ETensorType::FLOAT : case ETensorType::INT32 : case ETensorType::UINT32 : return 4;
+      case ETensorType::INT8 : case ETensorType::UNINT8 : case ETensorType::BOOL : return 1;
+      case ETensorType::FLOAT16 : case ETensorType::BFLOAT16 : case ETensorType::INT16 : case ETensorType::UINT16 : return 2;
+      case ETensorType::INT64 : case ETensorType::UINT64 : case ETensorType::DOUBLE : case ETensorType::COMPLEX64 : return 8;
+      default:{
+         throw std::runtime_error("TMVA SOFIE - size of tensor type " + ConvertTypeToString(type) + " is not known");
+      }
+   }
+}
+
 namespace{
 template<typename T>
 static inline void copy_vector_data(int_t no_of_copies, int_t input_size, T* input, T* target){  //only visible within this translation unit
@@ -94,14 +135,157 @@ T* UTILITY::Unidirectional_broadcast(const T* original_data, const std::vector<s
       return new_datavector;
 }
 
-std::string UTILITY::Clean_name(std::string input_tensor_name){
-   std::string s (input_tensor_name);
-   s.erase(std::remove_if(s.begin(), s.end(), []( char const& c ) -> bool { return !std::isalnum(c); } ), s.end());
+std::string UTILITY::Clean_name(const std::string& input_tensor_name){
+   std::string s;
+   s.reserve(input_tensor_name.size());
+   for (char c: input_tensor_name){
+      if (std::isalnum(static_cast<unsigned char>(c))) s += c;
+   }
    return s;
 }
 
+std::size_t UTILITY::CountZeroFloats(const void* data, std::size_t length){
+   const char* bytes = static_cast<const char*>(data);
+   std::size_t zeros = 0;
+   for (std::size_t i = 0; i < length; i++){
+      float value;
+      std::memcpy(&value, bytes + i * sizeof(float), sizeof(float));
+      zeros += (value == 0.f);
+   }
+   return zeros;
+}
+
+void UTILITY::QuantizeRowsInt8(const float* data, std::size_t rows, std::size_t cols, std::size_t padded_cols,
+                               std::int8_t* quantized, float* scales, std::int32_t* sums){
+   if (padded_cols < cols) throw std::runtime_error("TMVA::SOFIE Error in int8 quantization : padded row length is smaller than the row length");
+   for (std::size_t r = 0; r < rows; r++){
+      const float* row = data + r * cols;
+      float absmax = 0;
+      for (std::size_t c = 0; c < cols; c++){
+         absmax = std::max(absmax, std::fabs(row[c]));
+      }
+      scales[r] = (absmax > 0) ? absmax / 127.f : 1.f;
+      float inv_scale = 1.f / scales[r];
+      std::int32_t sum = 0;
+      std::int8_t* qrow = quantized + r * padded_cols;
+      for (std::size_t c = 0; c < cols; c++){
+         float q = std::nearbyint(row[c] * inv_scale);
+         q = std::min(127.f, std::max(-127.f, q));
+         qrow[c] = static_cast<std::int8_t>(q);
+         sum += qrow[c];
+      }
+      std::fill(qrow + cols, qrow + padded_cols, 0);
+      sums[r] = sum;
+   }
+}
+
+std::uint16_t UTILITY::ConvertFloatToHalf(float value){
+   std::uint32_t x;
+   std::memcpy(&x, &value, sizeof(x));
+   std::uint16_t sign = (x >> 16) & 0x8000;
+   std::uint32_t absx = x & 0x7fffffff;
+   if (absx >= 0x7f800000){         //inf or nan
+      return sign | 0x7c00 | (absx > 0x7f800000 ? 0x200 : 0);
+   }
+   if (absx >= 0x477ff000){         //rounds to a value above the largest half
+      return sign | 0x7c00;
+   }
+   if (absx < 0x38800000){          //half subnormal, exact scaling by 2^24 then rounding
+      float f;
+      std::memcpy(&f, &absx, sizeof(f));
+      return sign | static_cast<std::uint16_t>(std::nearbyint(f * 16777216.f));
+   }
+   std::uint32_t mantissa = absx & 0x7fffff;
+   std::uint32_t h = (((absx >> 23) - 112) << 10) | (mantissa >> 13);
+   std::uint32_t remainder = mantissa & 0x1fff;
+   if (remainder > 0x1000 || (remainder == 0x1000 && (h & 1))) h++;   //a carry correctly moves into the exponent
+   return sign | static_cast<std::uint16_t>(h);
+}
+
+float UTILITY::ConvertHalfToFloat(std::uint16_t value){
+   std::uint32_t sign = static_cast<std::uint32_t>(value & 0x8000) << 16;
+   std::uint32_t exponent = (value >> 10) & 0x1f;
+   std::uint32_t mantissa = value & 0x3ff;
+   std::uint32_t x;
+   if (exponent == 0){
+      float f = std::ldexp(static_cast<float>(mantissa), -24);
+      return sign ? -f : f;
+   }else if (exponent == 31){
+      x = sign | 0x7f800000 | (mantissa << 13);
+   }else{
+      x = sign | ((exponent + 112) << 23) | (mantissa << 13);
+   }
+   float f;
+   std::memcpy(&f, &x, sizeof(f));
+   return f;
+}
+
+std::uint16_t UTILITY::ConvertFloatToBFloat16(float value){
+   std::uint32_t x;
+   std::memcpy(&x, &value, sizeof(x));
+   if ((x & 0x7fffffff) > 0x7f800000){   //keep nan a quiet nan
+      return static_cast<std::uint16_t>((x >> 16) | 0x40);
+   }
+   x += 0x7fff + ((x >> 16) & 1);
+   return static_cast<std::uint16_t>(x >> 16);
+}
+
+float UTILITY::ConvertBFloat16ToFloat(std::uint16_t value){
+   std::uint32_t x = static_cast<std::uint32_t>(value) << 16;
+   float f;
+   std::memcpy(&f, &x, sizeof(f));
+   return f;
+}
+
 template float* UTILITY::Unidirectional_broadcast(const float* original_data, const std::vector<size_t> original_shape, const std::vector<size_t> target_shape);
 
+void UTILITY::AppendFloatLiteral(std::string& out, float value){
+   char buffer[32];
+   int length = 0;
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+   length = std::to_chars(buffer, buffer + sizeof(buffer), value).ptr - buffer;
+#else
+   //no shortest round trip formatting before C++17: increase the precision until the value reads back
+   for (int precision = 6; precision <= 9; precision++){
+      length = std::snprintf(buffer, sizeof(buffer), "%.*g", precision, value);
+      if (std::strtof(buffer, nullptr) == value) break;
+   }
+#endif
+   out.append(buffer, length);
+   if (std::isfinite(value)){
+      if (std::find_if(buffer, buffer + length, [](char c){ return c == '.' || c == 'e'; }) == buffer + length) out += '.';
+      out += 'f';   //parsed directly as float, no double rounding
+   }
+}
+
+void UTILITY::AppendHexFloatLiteral(std::string& out, float value){
+   if (!std::isfinite(value)){
+      AppendFloatLiteral(out, value);
+      return;
+   }
+   static const char digits[] = "0123456789abcdef";
+   std::uint32_t x;
+   std::memcpy(&x, &value, sizeof(x));
+   if (x >> 31) out += '-';
+   std::uint32_t exponent = (x >> 23) & 0xff;
+   std::uint32_t mantissa = (x & 0x7fffff) << 1;   //24 bits, 6 hex digits
+   if (exponent == 0 && mantissa == 0){
+      out += "0x0p+0f";
+      return;
+   }
+   out += (exponent == 0) ? "0x0" : "0x1";
+   if (mantissa != 0){
+      out += '.';
+      for (int shift = 20; shift >= 0 && (mantissa & ((1u << (shift + 4)) - 1)) != 0; shift -= 4){
+         out += digits[(mantissa >> shift) & 0xf];
+      }
+   }
+   int e = (exponent == 0) ? -126 : static_cast<int>(exponent) - 127;
+   out += (e < 0) ? "p-" : "p+";
+   out += std::to_string(std::abs(e));
+   out += 'f';
+}
+
 }//SOFIE
 }//Experimental
 }//TMVA
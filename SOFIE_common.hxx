@@ -16,6 +16,31 @@ namespace SOFIE{
 
 const bool fUseEigen = false;
 
+enum class Options {
+   kDefault = 0x0,
+   kInt8 = 0x1,            //quantize Gemm/Conv weights (per output channel) and activations to int8
+   kCalibration = 0x2,     //instrument generated code to record activation ranges
+   kFloat16Weights = 0x4,  //store Gemm weights as IEEE half, converted to float inside the kernel
+   kBFloat16Weights = 0x8, //store Gemm weights as bfloat16, converted to float inside the kernel
+   kInt8Weights = 0x10,    //store Gemm weights as int8 with per output column scales, activations stay float
+   kSparseInputs = 0x20,   //batch-1 Gemm skips the weights of zero inputs when the input is sparse enough
+   kShapesOnly = 0x40,     //Initialize infers shapes and broadcasts but leaves the weights as parsed (model snapshots)
+   kHexFloatWeights = 0x80, //float weights as exact hexadecimal literals, the generated code then needs C++17
+   kBinaryWeights = 0x100, //weights in a raw blob linked through a generated .incbin assembler stub, the header only declares them
+   kHugePageWeights = 0x200, //weights in an ELF section aligned to 2 MB, the generated AdviseHugePages() madvises it
+   kCInterface = 0x400,    //exports the C ABI of SOFIE_plugin.h, for a model built alone into a shared library
+   kSwappableWeights = 0x800, //infer reads the weights through a versioned set that LoadWeights/SetWeights replace at run time
+   kProfile = 0x1000,      //times every operator of sampled infer calls, the generated Profile namespace reports and traces them
+   kLatencyHistogram = 0x2000, //infer records its latency in per thread histograms, the generated Latency namespace snapshots them
+};
+
+inline std::underlying_type_t<Options> operator|(Options opA, Options opB) {
+   return static_cast<std::underlying_type_t<Options>>(opA) | static_cast<std::underlying_type_t<Options>>(opB);
+}
+inline std::underlying_type_t<Options> operator|(std::underlying_type_t<Options> opA, Options opB) {
+   return opA | static_cast<std::underlying_type_t<Options>>(opB);
+}
+
 //typedef RTensor tensor_t;
 
 enum class ETensorType{
@@ -26,6 +51,7 @@ enum class ETensorType{
 typedef std::int64_t int_t;
 
 std::string ConvertTypeToString(ETensorType type);
+std::size_t GetTypeSize(ETensorType type);
 
 struct Dim{
    bool isParam = false;
@@ -36,6 +62,9 @@ struct Dim{
 std::vector<Dim> ConvertShapeToDim(std::vector<size_t> shape);
 
 
+//index of a tensor in the interned tensor table of its RModel
+using TensorId = std::uint32_t;
+
 struct InputTensorInfo{
    ETensorType type;
    std::vector<Dim> shape;
@@ -46,7 +75,7 @@ struct TensorInfo{
    std::vector<size_t> shape;
 };
 
-std::size_t ConvertShapeToLength(std::vector<size_t> shape);
+std::size_t ConvertShapeToLength(const std::vector<size_t>& shape);
 
 struct InitializedTensor{
    ETensorType type;
@@ -55,6 +84,68 @@ struct InitializedTensor{
    //void* data;
 };
 
+//attributes an operator is rebuilt from when a model snapshot is loaded
+struct OperatorRecord{
+   std::string op_type;                          //ONNX operator type
+   ETensorType type = ETensorType::FLOAT;        //template type of the operator
+   std::vector<std::string> tensors;             //input and output names, empty for absent optional inputs
+   std::vector<std::string> strings;
+   std::vector<std::vector<std::int64_t>> ints;
+   std::vector<float> floats;
+};
+
+//work of one inference of an operator, from the shapes and stored weight types after Initialize
+struct OperatorCost{
+   std::string name;                   //op_N, N in execution order as in the generated code
+   std::string op_type;
+   std::string output;
+   std::size_t flops = 0;
+   std::size_t weight_bytes = 0;       //initialized tensors read, in their stored type
+   std::size_t input_bytes = 0;        //activations read
+   std::size_t output_bytes = 0;       //activations written
+   std::size_t GetBytes() const { return weight_bytes + input_bytes + output_bytes; }
+   //FLOPs per byte moved, the abscissa of the roofline
+   double GetIntensity() const { return GetBytes() > 0 ? static_cast<double>(flops) / GetBytes() : 0; }
+};
+
+//memory in use while one operator runs, from the shapes and stored weight types after Initialize
+struct OperatorMemory{
+   std::string name;                   //op_N as in OperatorCost
+   std::string op_type;
+   std::string output;
+   std::size_t scratch_bytes = 0;      //local arrays of its generated code
+   std::size_t static_bytes = 0;       //as generated: every intermediate tensor, and the scratch declared up to the operator
+   std::size_t live_bytes = 0;         //planned: the intermediates written before it and read from it on, and its own scratch
+};
+
+//memory footprint of one inference of a model, graph inputs excluded as they belong to the caller
+struct MemoryReport{
+   std::size_t weight_bytes = 0;       //initialized tensors, in their stored type
+   std::size_t intermediate_bytes = 0; //one static array per intermediate tensor
+   std::size_t scratch_bytes = 0;      //local arrays of all operators, which share the stack frame of infer
+   std::size_t static_peak_bytes = 0;  //largest static_bytes, the intermediates and the whole scratch
+   std::size_t live_peak_bytes = 0;    //largest live_bytes, what a planner reusing dead buffers would need
+   std::vector<OperatorMemory> ops;    //in execution order
+};
+
+//error introduced by storing a float weight tensor in a smaller type
+struct WeightConversionInfo{
+   ETensorType type;
+   std::size_t length;
+   double max_abs_error;
+   double rms_error;
+   double rms;
+};
+
+//error of a model output computed with the weights as stored against the float reference, over sample inputs
+struct OutputAccuracyInfo{
+   std::size_t length;
+   std::size_t samples;
+   double max_abs_error;
+   double rms_error;
+   double rms;
+};
+
 template <typename T>
 ETensorType GetTemplatedType(T obj){
    if (std::is_same<T, float>::value) return ETensorType::FLOAT;
@@ -76,7 +167,26 @@ ETensorType GetTemplatedType(T obj){
 namespace UTILITY{
 template<typename T>
 T* Unidirectional_broadcast(const T* original_data, const std::vector<size_t> original_shape, const std::vector<size_t> target_shape);
-std::string Clean_name(std::string input_tensor_name);
+std::string Clean_name(const std::string& input_tensor_name);
+
+//symmetric per-row int8 quantization of a row-major rows x cols matrix; each output row is zero padded to padded_cols
+//scales[r] = max|w[r,:]| / 127, sums[r] = sum of the quantized row (needed by the u8 x s8 VNNI kernel)
+void QuantizeRowsInt8(const float* data, std::size_t rows, std::size_t cols, std::size_t padded_cols,
+                      std::int8_t* quantized, float* scales, std::int32_t* sums);
+
+//zeros among length floats at data, which may be a misaligned view of a model file
+std::size_t CountZeroFloats(const void* data, std::size_t length);
+
+//round to nearest even conversions between float and the 16 bit float formats (IEEE half, bfloat16)
+std::uint16_t ConvertFloatToHalf(float value);
+float ConvertHalfToFloat(std::uint16_t value);
+std::uint16_t ConvertFloatToBFloat16(float value);
+float ConvertBFloat16ToFloat(std::uint16_t value);
+
+//C++ float literals for the generated code: the shortest decimal that reads back as exactly value,
+//or the exact hexadecimal form (a C++17 literal)
+void AppendFloatLiteral(std::string& out, float value);
+void AppendHexFloatLiteral(std::string& out, float value);
 }
 
 namespace BLAS{
@@ -0,0 +1,370 @@
+#include "SOFIE_kernels.hxx"
+
+namespace TMVA{
+namespace Experimental{
+namespace SOFIE{
+
+std::string KERNELS::Int8Gemm(){
+   return R"(#ifndef TMVA_SOFIE_KERNELS_INT8GEMM
+#define TMVA_SOFIE_KERNELS_INT8GEMM
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+#include <algorithm>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+namespace TMVA_SOFIE_KERNELS{
+
+inline float absmax_f32(const float* x, std::size_t n){
+   float m = 0;
+   for (std::size_t i = 0; i < n; i++) m = std::max(m, std::fabs(x[i]));
+   return (m > 0) ? m : 1.f;
+}
+
+//quantize a rows x cols matrix into int8 rows of stride padded_cols, padding is zero filled
+inline void quantize_s8(const float* x, std::size_t rows, std::size_t cols, std::size_t padded_cols, float scale, std::int8_t* q){
+   const float inv_scale = 1.f / scale;
+   for (std::size_t r = 0; r < rows; r++){
+      for (std::size_t c = 0; c < cols; c++){
+         float v = std::nearbyint(x[r * cols + c] * inv_scale);
+         q[r * padded_cols + c] = static_cast<std::int8_t>(std::min(127.f, std::max(-127.f, v)));
+      }
+      for (std::size_t c = cols; c < padded_cols; c++) q[r * padded_cols + c] = 0;
+   }
+}
+
+//same for a non negative matrix, e.g. the output of a Relu, which uses the whole [0, 255] range of uint8
+inline void quantize_u8(const float* x, std::size_t rows, std::size_t cols, std::size_t padded_cols, float scale, std::uint8_t* q){
+   const float inv_scale = 1.f / scale;
+   for (std::size_t r = 0; r < rows; r++){
+      for (std::size_t c = 0; c < cols; c++){
+         float v = std::nearbyint(x[r * cols + c] * inv_scale);
+         q[r * padded_cols + c] = static_cast<std::uint8_t>(std::min(255.f, std::max(0.f, v)));
+      }
+      for (std::size_t c = cols; c < padded_cols; c++) q[r * padded_cols + c] = 0;
+   }
+}
+
+#if defined(__AVX2__)
+inline std::int32_t hsum_epi32(__m256i v){
+   __m128i s = _mm_add_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+   s = _mm_add_epi32(s, _mm_shuffle_epi32(s, 0x4E));
+   s = _mm_add_epi32(s, _mm_shuffle_epi32(s, 0xB1));
+   return _mm_cvtsi128_si32(s);
+}
+#endif
+
+//dot product of two int8 vectors, k is a multiple of 32
+//wsum is the sum of w, it removes the +128 offset that makes a unsigned for the u8 x s8 VNNI instruction
+inline std::int32_t dot_s8(const std::int8_t* a, const std::int8_t* w, int k, std::int32_t wsum){
+#if (defined(__AVX512VNNI__) && defined(__AVX512VL__)) || defined(__AVXVNNI__)
+   const __m256i offset = _mm256_set1_epi8(static_cast<char>(0x80));
+   __m256i acc = _mm256_setzero_si256();
+   for (int i = 0; i < k; i += 32){
+      __m256i va = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i)), offset);
+      __m256i vw = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(w + i));
+#if defined(__AVX512VNNI__) && defined(__AVX512VL__)
+      acc = _mm256_dpbusd_epi32(acc, va, vw);
+#else
+      acc = _mm256_dpbusd_avx_epi32(acc, va, vw);
+#endif
+   }
+   return hsum_epi32(acc) - 128 * wsum;
+#elif defined(__AVX2__)
+   //maddubs would saturate u8 x s8 pair sums in int16, widen to int16 and use madd instead
+   __m256i acc = _mm256_setzero_si256();
+   for (int i = 0; i < k; i += 32){
+      __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+      __m256i vw = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(w + i));
+      __m256i a_lo = _mm256_cvtepi8_epi16(_mm256_castsi256_si128(va));
+      __m256i a_hi = _mm256_cvtepi8_epi16(_mm256_extracti128_si256(va, 1));
+      __m256i w_lo = _mm256_cvtepi8_epi16(_mm256_castsi256_si128(vw));
+      __m256i w_hi = _mm256_cvtepi8_epi16(_mm256_extracti128_si256(vw, 1));
+      acc = _mm256_add_epi32(acc, _mm256_madd_epi16(a_lo, w_lo));
+      acc = _mm256_add_epi32(acc, _mm256_madd_epi16(a_hi, w_hi));
+   }
+   (void) wsum;
+   return hsum_epi32(acc);
+#else
+   (void) wsum;
+   std::int32_t acc = 0;
+   for (int i = 0; i < k; i++) acc += static_cast<std::int32_t>(a[i]) * static_cast<std::int32_t>(w[i]);
+   return acc;
+#endif
+}
+
+//dot product of a uint8 and an int8 vector, k is a multiple of 32. The u8 x s8 VNNI instruction takes a as it is
+inline std::int32_t dot_u8(const std::uint8_t* a, const std::int8_t* w, int k){
+#if (defined(__AVX512VNNI__) && defined(__AVX512VL__)) || defined(__AVXVNNI__)
+   __m256i acc = _mm256_setzero_si256();
+   for (int i = 0; i < k; i += 32){
+      __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+      __m256i vw = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(w + i));
+#if defined(__AVX512VNNI__) && defined(__AVX512VL__)
+      acc = _mm256_dpbusd_epi32(acc, va, vw);
+#else
+      acc = _mm256_dpbusd_avx_epi32(acc, va, vw);
+#endif
+   }
+   return hsum_epi32(acc);
+#elif defined(__AVX2__)
+   __m256i acc = _mm256_setzero_si256();
+   for (int i = 0; i < k; i += 32){
+      __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+      __m256i vw = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(w + i));
+      __m256i a_lo = _mm256_cvtepu8_epi16(_mm256_castsi256_si128(va));
+      __m256i a_hi = _mm256_cvtepu8_epi16(_mm256_extracti128_si256(va, 1));
+      __m256i w_lo = _mm256_cvtepi8_epi16(_mm256_castsi256_si128(vw));
+      __m256i w_hi = _mm256_cvtepi8_epi16(_mm256_extracti128_si256(vw, 1));
+      acc = _mm256_add_epi32(acc, _mm256_madd_epi16(a_lo, w_lo));
+      acc = _mm256_add_epi32(acc, _mm256_madd_epi16(a_hi, w_hi));
+   }
+   return hsum_epi32(acc);
+#else
+   std::int32_t acc = 0;
+   for (int i = 0; i < k; i++) acc += static_cast<std::int32_t>(a[i]) * static_cast<std::int32_t>(w[i]);
+   return acc;
+#endif
+}
+
+//Y[i, j] = alpha * ascale * wscale[j] * (A[i, :] . W[j, :]) + beta * C[i, j]
+//A is m x k and W is n x k, both row major int8; Y and C are m x n float, row major or with column_major_y column major,
+//C may be null
+inline void gemm_s8(int m, int n, int k, const std::int8_t* A, const std::int8_t* W, const std::int32_t* wsum,
+                    const float* wscale, float ascale, float alpha, float beta, const float* C, float* Y, bool column_major_y = false){
+   for (int j = 0; j < n; j++){
+      const float scale = alpha * ascale * wscale[j];
+      for (int i = 0; i < m; i++){
+         const int index = column_major_y ? j * m + i : i * n + j;
+         float y = scale * static_cast<float>(dot_s8(A + i * k, W + j * k, k, wsum[j]));
+         if (C != nullptr) y += beta * C[index];
+         Y[index] = y;
+      }
+   }
+}
+
+//same with A uint8, quantized by quantize_u8
+inline void gemm_u8(int m, int n, int k, const std::uint8_t* A, const std::int8_t* W, const float* wscale, float ascale,
+                    float alpha, float beta, const float* C, float* Y, bool column_major_y = false){
+   for (int j = 0; j < n; j++){
+      const float scale = alpha * ascale * wscale[j];
+      for (int i = 0; i < m; i++){
+         const int index = column_major_y ? j * m + i : i * n + j;
+         float y = scale * static_cast<float>(dot_u8(A + i * k, W + j * k, k));
+         if (C != nullptr) y += beta * C[index];
+         Y[index] = y;
+      }
+   }
+}
+
+}//TMVA_SOFIE_KERNELS
+#endif //TMVA_SOFIE_KERNELS_INT8GEMM
+)";
+}
+
+std::string KERNELS::HalfWeightGemm(){
+   return R"(#ifndef TMVA_SOFIE_KERNELS_HALFWEIGHTGEMM
+#define TMVA_SOFIE_KERNELS_HALFWEIGHTGEMM
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+#if defined(__AVX2__) || defined(__F16C__)
+#include <immintrin.h>
+#endif
+namespace TMVA_SOFIE_KERNELS{
+
+inline float half_to_float(std::uint16_t h){
+   std::uint32_t sign = static_cast<std::uint32_t>(h & 0x8000) << 16;
+   std::uint32_t exponent = (h >> 10) & 0x1f;
+   std::uint32_t mantissa = h & 0x3ff;
+   std::uint32_t x;
+   if (exponent == 0){
+      float f = std::ldexp(static_cast<float>(mantissa), -24);
+      return sign ? -f : f;
+   }
+   x = sign | ((exponent == 31) ? 0x7f800000 : (exponent + 112) << 23) | (mantissa << 13);
+   float f;
+   std::memcpy(&f, &x, sizeof(f));
+   return f;
+}
+
+inline float bfloat16_to_float(std::uint16_t h){
+   std::uint32_t x = static_cast<std::uint32_t>(h) << 16;
+   float f;
+   std::memcpy(&f, &x, sizeof(f));
+   return f;
+}
+
+//a . w with w stored as IEEE half
+inline float dot_f16w(const float* a, const std::uint16_t* w, int k){
+   int i = 0;
+   float sum = 0;
+#if defined(__F16C__) && defined(__FMA__)
+   __m256 acc0 = _mm256_setzero_ps();
+   __m256 acc1 = _mm256_setzero_ps();
+   for (; i + 16 <= k; i += 16){
+      __m256 w0 = _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(w + i)));
+      __m256 w1 = _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(w + i + 8)));
+      acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i), w0, acc0);
+      acc1 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i + 8), w1, acc1);
+   }
+   __m256 acc = _mm256_add_ps(acc0, acc1);
+   __m128 s = _mm_add_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc, 1));
+   s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+   s = _mm_add_ss(s, _mm_shuffle_ps(s, s, 0x1));
+   sum = _mm_cvtss_f32(s);
+#endif
+   for (; i < k; i++) sum += a[i] * half_to_float(w[i]);
+   return sum;
+}
+
+//a . w with w stored as bfloat16, the conversion is a 16 bit shift
+inline float dot_bf16w(const float* a, const std::uint16_t* w, int k){
+   int i = 0;
+   float sum = 0;
+#if defined(__AVX2__) && defined(__FMA__)
+   __m256 acc0 = _mm256_setzero_ps();
+   __m256 acc1 = _mm256_setzero_ps();
+   for (; i + 16 <= k; i += 16){
+      __m256i w01 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(w + i));
+      __m256 w0 = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(_mm256_castsi256_si128(w01)), 16));
+      __m256 w1 = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(_mm256_extracti128_si256(w01, 1)), 16));
+      acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i), w0, acc0);
+      acc1 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i + 8), w1, acc1);
+   }
+   __m256 acc = _mm256_add_ps(acc0, acc1);
+   __m128 s = _mm_add_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc, 1));
+   s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+   s = _mm_add_ss(s, _mm_shuffle_ps(s, s, 0x1));
+   sum = _mm_cvtss_f32(s);
+#endif
+   for (; i < k; i++) sum += a[i] * bfloat16_to_float(w[i]);
+   return sum;
+}
+
+//Y[i, j] = alpha * (A[i, :] . W[j, :]) + beta * C[i, j], A is m x k float and W is n x k in 16 bit storage, C may be null
+inline void gemm_f16w(int m, int n, int k, const float* A, const std::uint16_t* W, bool bfloat16, float alpha, float beta, const float* C, float* Y){
+   for (int j = 0; j < n; j++){
+      for (int i = 0; i < m; i++){
+         float y = alpha * (bfloat16 ? dot_bf16w(A + i * k, W + j * k, k) : dot_f16w(A + i * k, W + j * k, k));
+         if (C != nullptr) y += beta * C[i * n + j];
+         Y[i * n + j] = y;
+      }
+   }
+}
+
+}//TMVA_SOFIE_KERNELS
+#endif //TMVA_SOFIE_KERNELS_HALFWEIGHTGEMM
+)";
+}
+
+std::string KERNELS::Int8WeightGemm(){
+   return R"(#ifndef TMVA_SOFIE_KERNELS_INT8WEIGHTGEMM
+#define TMVA_SOFIE_KERNELS_INT8WEIGHTGEMM
+#include <cstdint>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+namespace TMVA_SOFIE_KERNELS{
+
+//a . w with w stored as int8, the per row scale is applied by the caller
+inline float dot_s8w(const float* a, const std::int8_t* w, int k){
+   int i = 0;
+   float sum = 0;
+#if defined(__AVX2__) && defined(__FMA__)
+   __m256 acc0 = _mm256_setzero_ps();
+   __m256 acc1 = _mm256_setzero_ps();
+   for (; i + 16 <= k; i += 16){
+      __m128i w01 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(w + i));
+      __m256 w0 = _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(w01));
+      __m256 w1 = _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(_mm_srli_si128(w01, 8)));
+      acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i), w0, acc0);
+      acc1 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i + 8), w1, acc1);
+   }
+   __m256 acc = _mm256_add_ps(acc0, acc1);
+   __m128 s = _mm_add_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc, 1));
+   s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+   s = _mm_add_ss(s, _mm_shuffle_ps(s, s, 0x1));
+   sum = _mm_cvtss_f32(s);
+#endif
+   for (; i < k; i++) sum += a[i] * static_cast<float>(w[i]);
+   return sum;
+}
+
+//Y[i, j] = alpha * wscale[j] * (A[i, :] . W[j, :]) + beta * C[i, j], A is m x k float and W is n x k int8, C may be null
+inline void gemm_s8w(int m, int n, int k, const float* A, const std::int8_t* W, const float* wscale, float alpha, float beta, const float* C, float* Y){
+   for (int j = 0; j < n; j++){
+      const float scale = alpha * wscale[j];
+      for (int i = 0; i < m; i++){
+         float y = scale * dot_s8w(A + i * k, W + j * k, k);
+         if (C != nullptr) y += beta * C[i * n + j];
+         Y[i * n + j] = y;
+      }
+   }
+}
+
+}//TMVA_SOFIE_KERNELS
+#endif //TMVA_SOFIE_KERNELS_INT8WEIGHTGEMM
+)";
+}
+
+std::string KERNELS::SparseGemm(){
+   return R"(#ifndef TMVA_SOFIE_KERNELS_SPARSEGEMM
+#define TMVA_SOFIE_KERNELS_SPARSEGEMM
+#include <cstdint>
+namespace TMVA_SOFIE_KERNELS{
+
+//Y[i, j] = alpha * (A[i, :] . W[j, :]) + beta * C[i, j], A is m x k float, W is n x k in CSR format, C may be null
+inline void gemm_csr(int m, int n, int k, const float* A, const float* values, const std::int32_t* colidx, const std::int32_t* rowptr,
+                     float alpha, float beta, const float* C, float* Y){
+   for (int i = 0; i < m; i++){
+      const float* a = A + i * k;
+      for (int j = 0; j < n; j++){
+         float sum = 0;
+         for (std::int32_t p = rowptr[j]; p < rowptr[j + 1]; p++){
+            sum += values[p] * a[colidx[p]];
+         }
+         float y = alpha * sum;
+         if (C != nullptr) y += beta * C[i * n + j];
+         Y[i * n + j] = y;
+      }
+   }
+}
+
+}//TMVA_SOFIE_KERNELS
+#endif //TMVA_SOFIE_KERNELS_SPARSEGEMM
+)";
+}
+
+std::string KERNELS::SparseInputGemv(){
+   return R"(#ifndef TMVA_SOFIE_KERNELS_SPARSEINPUTGEMV
+#define TMVA_SOFIE_KERNELS_SPARSEINPUTGEMV
+namespace TMVA_SOFIE_KERNELS{
+
+inline int count_nonzero(const float* x, int k){
+   int nnz = 0;
+   for (int p = 0; p < k; p++) nnz += (x[p] != 0);
+   return nnz;
+}
+
+//y = alpha * x W + beta * c for a single row x, W is k x n row major, c may be null
+//rows of W belonging to zero entries of x are never read
+inline void gemv_sparse_x(int n, int k, const float* x, const float* W, float alpha, float beta, const float* c, float* y){
+   for (int j = 0; j < n; j++) y[j] = (c != nullptr) ? beta * c[j] : 0.f;
+   for (int p = 0; p < k; p++){
+      if (x[p] == 0) continue;
+      const float s = alpha * x[p];
+      const float* w = W + p * n;
+      for (int j = 0; j < n; j++) y[j] += s * w[j];
+   }
+}
+
+}//TMVA_SOFIE_KERNELS
+#endif //TMVA_SOFIE_KERNELS_SPARSEINPUTGEMV
+)";
+}
+
+}//SOFIE
+}//Experimental
+}//TMVA
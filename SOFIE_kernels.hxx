@@ -0,0 +1,31 @@
+#ifndef TMVA_SOFIE_SOFIE_KERNELS
+#define TMVA_SOFIE_SOFIE_KERNELS
+
+#include <string>
+#include <cstddef>
+
+namespace TMVA{
+namespace Experimental{
+namespace SOFIE{
+
+//source code of the helper kernels emitted into the generated code through ROperator::Header()
+//every snippet is include guarded and lives in namespace TMVA_SOFIE_KERNELS, so that several generated
+//models can be included in the same translation unit
+namespace KERNELS{
+
+//row length of int8 operands is padded to a multiple of this, so that the kernels need no scalar tail
+constexpr std::size_t kInt8RowAlignment = 32;
+
+std::string Int8Gemm();
+std::string HalfWeightGemm();
+std::string Int8WeightGemm();
+std::string SparseGemm();
+std::string SparseInputGemv();
+
+}//KERNELS
+
+}//SOFIE
+}//Experimental
+}//TMVA
+
+#endif //TMVA_SOFIE_SOFIE_KERNELS
@@ -0,0 +1,329 @@
+#include "SOFIE_onnx.hxx"
+
+#include <stdexcept>
+#include <fstream>
+#include <cstring>
+#include <thread>
+#include <exception>
+#include <algorithm>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace TMVA{
+namespace Experimental{
+namespace SOFIE{
+
+MappedFile::MappedFile(const std::string& filename){
+#ifndef _WIN32
+   int fd = open(filename.c_str(), O_RDONLY);
+   if (fd < 0){
+      throw std::runtime_error("TMVA::SOFIE - Failed to open file " + filename);
+   }
+   struct stat st;
+   if (fstat(fd, &st) != 0){
+      close(fd);
+      throw std::runtime_error("TMVA::SOFIE - Failed to stat file " + filename);
+   }
+   fSize = st.st_size;
+   if (fSize > 0){
+      //private writable mapping: pages are shared with the page cache until someone writes to a tensor
+      void* mapping = mmap(nullptr, fSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+      if (mapping == MAP_FAILED){
+         close(fd);
+         throw std::runtime_error("TMVA::SOFIE - Failed to map file " + filename);
+      }
+      fData = static_cast<char*>(mapping);
+      fMapped = true;
+   }
+   close(fd);
+#else
+   std::ifstream input(filename, std::ios::in | std::ios::binary | std::ios::ate);
+   if (!input.is_open()){
+      throw std::runtime_error("TMVA::SOFIE - Failed to open file " + filename);
+   }
+   fSize = input.tellg();
+   fData = new char[fSize];
+   input.seekg(0);
+   input.read(fData, fSize);
+#endif
+}
+
+MappedFile::~MappedFile(){
+#ifndef _WIN32
+   if (fMapped) munmap(fData, fSize);
+#else
+   delete[] fData;
+#endif
+}
+
+namespace ONNX{
+
+namespace{
+
+enum EWireType { kVarint = 0, kFixed64 = 1, kLengthDelimited = 2, kFixed32 = 5 };
+
+//minimal protobuf wire format decoder over a span of bytes
+class WireReader{
+private:
+   const unsigned char* fPos;
+   const unsigned char* fEnd;
+
+   [[noreturn]] static void Error(){
+      throw std::runtime_error("TMVA::SOFIE - Failed to parse onnx file: malformed protobuf message");
+   }
+
+public:
+   WireReader(Span message): fPos(reinterpret_cast<const unsigned char*>(message.data)), fEnd(fPos + message.size) {}
+
+   bool Next(std::uint32_t& field, int& wiretype){
+      if (fPos >= fEnd) return false;
+      std::uint64_t key = Varint();
+      field = key >> 3;
+      wiretype = key & 0x7;
+      return true;
+   }
+
+   std::uint64_t Varint(){
+      std::uint64_t value = 0;
+      for (int shift = 0; shift < 64; shift += 7){
+         if (fPos >= fEnd) Error();
+         unsigned char byte = *fPos++;
+         value |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+         if (!(byte & 0x80)) return value;
+      }
+      Error();
+   }
+
+   float Fixed32Float(){
+      if (fEnd - fPos < 4) Error();
+      float value;
+      std::memcpy(&value, fPos, sizeof(value));
+      fPos += 4;
+      return value;
+   }
+
+   Span LengthDelimited(){
+      std::uint64_t length = Varint();
+      if (length > static_cast<std::uint64_t>(fEnd - fPos)) Error();
+      Span s {reinterpret_cast<const char*>(fPos), static_cast<std::size_t>(length)};
+      fPos += length;
+      return s;
+   }
+
+   std::string String(){
+      Span s = LengthDelimited();
+      return std::string(s.data, s.size);
+   }
+
+   //repeated scalar fields may come packed (proto3 default) or one entry per tag
+   void Int64s(int wiretype, std::vector<std::int64_t>& values){
+      if (wiretype == kLengthDelimited){
+         WireReader packed(LengthDelimited());
+         while (packed.fPos < packed.fEnd) values.push_back(static_cast<std::int64_t>(packed.Varint()));
+      }else{
+         values.push_back(static_cast<std::int64_t>(Varint()));
+      }
+   }
+
+   void Skip(int wiretype){
+      switch (wiretype){
+         case kVarint: Varint(); break;
+         case kFixed64: if (fEnd - fPos < 8) Error(); fPos += 8; break;
+         case kLengthDelimited: LengthDelimited(); break;
+         case kFixed32: if (fEnd - fPos < 4) Error(); fPos += 4; break;
+         default: Error();
+      }
+   }
+};
+
+}//anonymous namespace
+
+void AttributeProto::Parse(Span message){
+   WireReader reader(message);
+   std::uint32_t field;
+   int wiretype;
+   while (reader.Next(field, wiretype)){
+      switch (field){
+         case 1: fName = reader.String(); break;
+         case 2: fF = reader.Fixed32Float(); break;
+         case 3: fI = static_cast<std::int64_t>(reader.Varint()); break;
+         case 4: fS = reader.String(); break;
+         case 7:
+            if (wiretype == kLengthDelimited){
+               Span packed = reader.LengthDelimited();
+               std::size_t n = packed.size / sizeof(float);
+               fFloats.resize(fFloats.size() + n);
+               std::memcpy(fFloats.data() + fFloats.size() - n, packed.data, n * sizeof(float));
+            }else{
+               fFloats.push_back(reader.Fixed32Float());
+            }
+            break;
+         case 8: reader.Int64s(wiretype, fInts); break;
+         default: reader.Skip(wiretype);
+      }
+   }
+}
+
+void NodeProto::Parse(Span message){
+   WireReader reader(message);
+   std::uint32_t field;
+   int wiretype;
+   while (reader.Next(field, wiretype)){
+      switch (field){
+         case 1: fInput.push_back(reader.String()); break;
+         case 2: fOutput.push_back(reader.String()); break;
+         case 3: fName = reader.String(); break;
+         case 4: fOpType = reader.String(); break;
+         case 5: fAttribute.emplace_back(); fAttribute.back().Parse(reader.LengthDelimited()); break;
+         default: reader.Skip(wiretype);
+      }
+   }
+}
+
+void TensorProto::Parse(Span message){
+   WireReader reader(message);
+   std::uint32_t field;
+   int wiretype;
+   while (reader.Next(field, wiretype)){
+      switch (field){
+         case 1: reader.Int64s(wiretype, fDims); break;
+         case 2: fDataType = static_cast<std::int32_t>(reader.Varint()); break;
+         case 4:
+            if (wiretype == kLengthDelimited){
+               fPackedFloatData = reader.LengthDelimited();
+            }else{
+               fFloatData.push_back(reader.Fixed32Float());
+            }
+            break;
+         case 8: fName = reader.String(); break;
+         case 9: fRawData = reader.LengthDelimited(); break;
+         case 13: {   //StringStringEntryProto
+            std::pair<std::string, std::string> entry;
+            WireReader kv(reader.LengthDelimited());
+            while (kv.Next(field, wiretype)){
+               if (field == 1) entry.first = kv.String();
+               else if (field == 2) entry.second = kv.String();
+               else kv.Skip(wiretype);
+            }
+            fExternalData.push_back(entry);
+            break;
+         }
+         case 14: fDataLocation = static_cast<DataLocation>(reader.Varint()); break;
+         default: reader.Skip(wiretype);
+      }
+   }
+}
+
+void ValueInfoProto::Parse(Span message){
+   WireReader reader(message);
+   std::uint32_t field;
+   int wiretype;
+   while (reader.Next(field, wiretype)){
+      if (field == 1){
+         fName = reader.String();
+      }else if (field == 2){   //TypeProto
+         WireReader type(reader.LengthDelimited());
+         while (type.Next(field, wiretype)){
+            if (field != 1){ type.Skip(wiretype); continue; }
+            WireReader tensor_type(type.LengthDelimited());   //TypeProto.Tensor
+            while (tensor_type.Next(field, wiretype)){
+               if (field == 1){
+                  fElemType = static_cast<std::int32_t>(tensor_type.Varint());
+               }else if (field == 2){   //TensorShapeProto
+                  fHasShape = true;
+                  WireReader shape(tensor_type.LengthDelimited());
+                  while (shape.Next(field, wiretype)){
+                     if (field != 1){ shape.Skip(wiretype); continue; }
+                     Dimension dim;
+                     WireReader dimension(shape.LengthDelimited());
+                     while (dimension.Next(field, wiretype)){
+                        if (field == 1){
+                           dim.value_case = Dimension::ValueCase::kDimValue;
+                           dim.dim_value = static_cast<std::int64_t>(dimension.Varint());
+                        }else if (field == 2){
+                           dim.value_case = Dimension::ValueCase::kDimParam;
+                           dim.dim_param = dimension.String();
+                        }else{
+                           dimension.Skip(wiretype);
+                        }
+                     }
+                     fDims.push_back(dim);
+                  }
+               }else{
+                  tensor_type.Skip(wiretype);
+               }
+            }
+         }
+      }else{
+         reader.Skip(wiretype);
+      }
+   }
+}
+
+void GraphProto::Parse(Span message){
+   WireReader reader(message);
+   std::uint32_t field;
+   int wiretype;
+   std::vector<Span> initializers;
+   while (reader.Next(field, wiretype)){
+      switch (field){
+         case 1: fNode.emplace_back(); fNode.back().Parse(reader.LengthDelimited()); break;
+         case 5: initializers.push_back(reader.LengthDelimited()); break;
+         case 11: fInput.emplace_back(); fInput.back().Parse(reader.LengthDelimited()); break;
+         case 12: fOutput.emplace_back(); fOutput.back().Parse(reader.LengthDelimited()); break;
+         default: reader.Skip(wiretype);
+      }
+   }
+
+   //initializers are independent messages, decode them in parallel when there are many
+   fInitializer.resize(initializers.size());
+   std::size_t n_threads = std::min<std::size_t>(std::max(1u, std::thread::hardware_concurrency()), initializers.size() / 16);
+   if (n_threads <= 1){
+      for (std::size_t i = 0; i < initializers.size(); i++) fInitializer[i].Parse(initializers[i]);
+      return;
+   }
+   std::vector<std::thread> workers;
+   std::vector<std::exception_ptr> errors(n_threads);
+   for (std::size_t t = 0; t < n_threads; t++){
+      workers.emplace_back([&, t](){
+         try{
+            for (std::size_t i = t; i < initializers.size(); i += n_threads) fInitializer[i].Parse(initializers[i]);
+         }catch(...){
+            errors[t] = std::current_exception();
+         }
+      });
+   }
+   for (auto& w: workers) w.join();
+   for (auto& e: errors){
+      if (e) std::rethrow_exception(e);
+   }
+}
+
+void ModelProto::ParseFromFile(const std::string& filename){
+   fFile = std::make_shared<MappedFile>(filename);
+   WireReader reader(Span{fFile->data(), fFile->size()});
+   std::uint32_t field;
+   int wiretype;
+   bool has_graph = false;
+   while (reader.Next(field, wiretype)){
+      if (field == 7 && wiretype == kLengthDelimited){
+         fGraph.Parse(reader.LengthDelimited());
+         has_graph = true;
+      }else{
+         reader.Skip(wiretype);
+      }
+   }
+   if (!has_graph){
+      throw std::runtime_error("TMVA::SOFIE - Failed to parse onnx file: " + filename + " has no graph");
+   }
+}
+
+}//ONNX
+}//SOFIE
+}//Experimental
+}//TMVA
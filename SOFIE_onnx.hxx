@@ -0,0 +1,170 @@
+#ifndef TMVA_SOFIE_SOFIE_ONNX
+#define TMVA_SOFIE_SOFIE_ONNX
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <memory>
+#include <utility>
+
+namespace TMVA{
+namespace Experimental{
+namespace SOFIE{
+
+//read-only view of a whole file: mmap'ed (copy on write) on POSIX systems, read into memory otherwise
+class MappedFile{
+private:
+   char* fData = nullptr;
+   std::size_t fSize = 0;
+   bool fMapped = false;
+
+public:
+   MappedFile(const std::string& filename);
+   ~MappedFile();
+   MappedFile(const MappedFile& other) = delete;
+   MappedFile& operator=(const MappedFile& other) = delete;
+
+   char* data() const { return fData; }
+   std::size_t size() const { return fSize; }
+};
+
+//lightweight reader of the ONNX protobuf wire format (schema in onnx_proto3.proto)
+//the file is memory mapped and the bulk data of the tensors are views into the mapping, no libprotobuf involved
+//accessors follow the naming of the protobuf generated classes; only the fields SOFIE uses are decoded
+namespace ONNX{
+
+//bytes of a field inside the mapped file
+struct Span{
+   const char* data = nullptr;
+   std::size_t size = 0;
+};
+
+class AttributeProto{
+private:
+   std::string fName;
+   float fF = 0;
+   std::int64_t fI = 0;
+   std::string fS;
+   std::vector<float> fFloats;
+   std::vector<std::int64_t> fInts;
+
+public:
+   void Parse(Span message);
+   const std::string& name() const { return fName; }
+   float f() const { return fF; }
+   std::int64_t i() const { return fI; }
+   const std::string& s() const { return fS; }
+   const std::vector<float>& floats() const { return fFloats; }
+   const std::vector<std::int64_t>& ints() const { return fInts; }
+};
+
+class NodeProto{
+private:
+   std::vector<std::string> fInput;
+   std::vector<std::string> fOutput;
+   std::string fName;
+   std::string fOpType;
+   std::vector<AttributeProto> fAttribute;
+
+public:
+   void Parse(Span message);
+   const std::string& input(int i) const { return fInput[i]; }
+   int input_size() const { return fInput.size(); }
+   const std::string& output(int i) const { return fOutput[i]; }
+   int output_size() const { return fOutput.size(); }
+   const std::string& name() const { return fName; }
+   const std::string& op_type() const { return fOpType; }
+   const AttributeProto& attribute(int i) const { return fAttribute[i]; }
+   int attribute_size() const { return fAttribute.size(); }
+};
+
+class TensorProto{
+public:
+   enum DataLocation { DEFAULT = 0, EXTERNAL = 1 };
+
+private:
+   std::vector<std::int64_t> fDims;
+   std::int32_t fDataType = 0;
+   std::string fName;
+   Span fRawData;
+   Span fPackedFloatData;              //proto3 packed encoding: little endian floats, usable in place
+   std::vector<float> fFloatData;      //legacy unpacked encoding
+   std::vector<std::pair<std::string, std::string>> fExternalData;   //location, offset, length, checksum
+   DataLocation fDataLocation = DEFAULT;
+
+public:
+   void Parse(Span message);
+   const std::string& name() const { return fName; }
+   std::int32_t data_type() const { return fDataType; }
+   std::int64_t dims(int i) const { return fDims[i]; }
+   int dims_size() const { return fDims.size(); }
+   Span raw_data() const { return fRawData; }
+   Span packed_float_data() const { return fPackedFloatData; }
+   const std::vector<float>& float_data() const { return fFloatData; }
+   const std::vector<std::pair<std::string, std::string>>& external_data() const { return fExternalData; }
+   DataLocation data_location() const { return fDataLocation; }
+};
+
+class ValueInfoProto{
+public:
+   struct Dimension{
+      enum class ValueCase { kNotSet, kDimValue, kDimParam };
+      ValueCase value_case = ValueCase::kNotSet;
+      std::int64_t dim_value = 0;
+      std::string dim_param;
+   };
+
+private:
+   std::string fName;
+   std::int32_t fElemType = 0;
+   bool fHasShape = false;
+   std::vector<Dimension> fDims;
+
+public:
+   void Parse(Span message);
+   const std::string& name() const { return fName; }
+   std::int32_t elem_type() const { return fElemType; }
+   bool has_shape() const { return fHasShape; }
+   const Dimension& dim(int i) const { return fDims[i]; }
+   int dim_size() const { return fDims.size(); }
+};
+
+class GraphProto{
+private:
+   std::vector<NodeProto> fNode;
+   std::vector<TensorProto> fInitializer;
+   std::vector<ValueInfoProto> fInput;
+   std::vector<ValueInfoProto> fOutput;
+
+public:
+   void Parse(Span message);
+   const NodeProto& node(int i) const { return fNode[i]; }
+   int node_size() const { return fNode.size(); }
+   const TensorProto& initializer(int i) const { return fInitializer[i]; }
+   int initializer_size() const { return fInitializer.size(); }
+   const ValueInfoProto& input(int i) const { return fInput[i]; }
+   int input_size() const { return fInput.size(); }
+   const ValueInfoProto& output(int i) const { return fOutput[i]; }
+   int output_size() const { return fOutput.size(); }
+};
+
+class ModelProto{
+private:
+   std::shared_ptr<MappedFile> fFile;
+   GraphProto fGraph;
+
+public:
+   void ParseFromFile(const std::string& filename);
+   const GraphProto& graph() const { return fGraph; }
+   //owner of the mapping, the views returned by the tensors stay valid as long as a copy of it is alive
+   const std::shared_ptr<MappedFile>& file() const { return fFile; }
+};
+
+}//ONNX
+
+}//SOFIE
+}//Experimental
+}//TMVA
+
+#endif //TMVA_SOFIE_SOFIE_ONNX
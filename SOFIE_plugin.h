@@ -0,0 +1,75 @@
+/* C ABI of a model generated with Options::kCInterface and built alone into a shared library.
+   The host is compiled once against this header and loads any such model with dlopen: the functions below are
+   resolved with dlsym by name (the _fn typedefs), or linked directly. Tensors are described with the ONNX
+   TensorProto data types (1 for float); inputs and outputs are passed in the order of their index */
+#ifndef SOFIE_PLUGIN_H
+#define SOFIE_PLUGIN_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SOFIE_ABI_VERSION 1
+
+/* return codes of sofie_run */
+#define SOFIE_OK 0
+#define SOFIE_ERROR_ARGUMENT 1
+#define SOFIE_ERROR_RUNTIME 2
+
+/* a session runs one inference at a time; runs of different sessions of a library are serialized, the generated
+   code keeps its intermediate tensors in static storage */
+typedef struct sofie_session sofie_session;
+
+int sofie_abi_version(void);
+const char* sofie_model_name(void);
+
+sofie_session* sofie_create_session(void);   /* null on failure */
+void sofie_destroy_session(sofie_session* session);
+
+/* the queries return null (or 0) for an index out of range */
+size_t sofie_num_inputs(void);
+const char* sofie_input_name(size_t index);
+int sofie_input_dtype(size_t index);
+size_t sofie_input_rank(size_t index);
+const size_t* sofie_input_shape(size_t index);
+size_t sofie_num_outputs(void);
+const char* sofie_output_name(size_t index);
+int sofie_output_dtype(size_t index);
+size_t sofie_output_rank(size_t index);
+const size_t* sofie_output_shape(size_t index);
+
+/* reads sofie_num_inputs() buffers and writes sofie_num_outputs() caller allocated buffers, returns SOFIE_OK or an error */
+int sofie_run(sofie_session* session, const void* const* inputs, void* const* outputs);
+
+/* work and memory of one inference: floating point operations, bytes of weights and of intermediate tensors */
+uint64_t sofie_flops(void);
+size_t sofie_weight_bytes(void);
+size_t sofie_intermediate_bytes(void);
+
+/* latency in nanoseconds of the runs of a session, or of every inference of the library when session is null, at the
+   quantiles[0..n) (e.g. 0.5, 0.99) written to values, within 1/32; returns the number of runs recorded. Only exported
+   by models generated with Options::kLatencyHistogram, resolve it with dlsym to find out */
+uint64_t sofie_latency_quantiles(const sofie_session* session, const double* quantiles, double* values, size_t n);
+
+typedef int (*sofie_abi_version_fn)(void);
+typedef const char* (*sofie_model_name_fn)(void);
+typedef sofie_session* (*sofie_create_session_fn)(void);
+typedef void (*sofie_destroy_session_fn)(sofie_session*);
+typedef size_t (*sofie_num_tensors_fn)(void);
+typedef const char* (*sofie_tensor_name_fn)(size_t);
+typedef int (*sofie_tensor_dtype_fn)(size_t);
+typedef size_t (*sofie_tensor_rank_fn)(size_t);
+typedef const size_t* (*sofie_tensor_shape_fn)(size_t);
+typedef int (*sofie_run_fn)(sofie_session*, const void* const*, void* const*);
+typedef uint64_t (*sofie_flops_fn)(void);
+typedef size_t (*sofie_bytes_fn)(void);
+typedef uint64_t (*sofie_latency_quantiles_fn)(const sofie_session*, const double*, double*, size_t);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SOFIE_PLUGIN_H */
@@ -0,0 +1,135 @@
+//scaling of Parse, Initialize and Generate with the graph size: a synthetic chain Gemm -> Relu -> Gemm -> ... of n nodes
+//with 4x4 weights is written as an onnx file and run through the parser and the generator
+//usage: benchgraph [max number of nodes, default 100000]
+
+#include "RModel.hxx"
+#include "RModelParser_ONNX.hxx"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
+using namespace TMVA::Experimental::SOFIE;
+
+namespace{
+
+//minimal protobuf wire format encoder, enough for the messages of the synthetic graph
+struct Message{
+   std::string bytes;
+
+   void Varint(std::uint64_t value){
+      while (value >= 0x80){
+         bytes += static_cast<char>((value & 0x7f) | 0x80);
+         value >>= 7;
+      }
+      bytes += static_cast<char>(value);
+   }
+   void Key(int field, int wiretype){
+      Varint(static_cast<std::uint64_t>(field) << 3 | wiretype);
+   }
+   void Int(int field, std::uint64_t value){
+      Key(field, 0);
+      Varint(value);
+   }
+   void Bytes(int field, const std::string& value){
+      Key(field, 2);
+      Varint(value.size());
+      bytes += value;
+   }
+   void Sub(int field, const Message& message){
+      Bytes(field, message.bytes);
+   }
+};
+
+const int kWidth = 4;
+const int kFloat = 1;   //onnx TensorProto.DataType.FLOAT
+
+Message ValueInfo(const std::string& name){
+   Message dim_batch, dim_width, shape, tensor_type, type, info;
+   dim_batch.Int(1, 1);
+   dim_width.Int(1, kWidth);
+   shape.Sub(1, dim_batch);
+   shape.Sub(1, dim_width);
+   tensor_type.Int(1, kFloat);
+   tensor_type.Sub(2, shape);
+   type.Sub(1, tensor_type);
+   info.Bytes(1, name);
+   info.Sub(2, type);
+   return info;
+}
+
+Message Initializer(const std::string& name, std::vector<std::size_t> shape, int seed){
+   Message tensor;
+   for (auto dim: shape) tensor.Int(1, dim);
+   tensor.Int(2, kFloat);
+   tensor.Bytes(8, name);
+   std::string raw;
+   for (std::size_t i = 0; i < ConvertShapeToLength(shape); i++){
+      float value = ((seed * 31 + i * 7) % 17 - 8) / 16.f;
+      raw.append(reinterpret_cast<const char*>(&value), sizeof(value));
+   }
+   tensor.Bytes(9, raw);
+   return tensor;
+}
+
+void WriteChain(const std::string& filename, int n_nodes){
+   Message graph;
+   std::string previous = "input";
+   for (int i = 0; i < n_nodes; i++){
+      std::string output = "t" + std::to_string(i);
+      Message node;
+      node.Bytes(1, previous);
+      if (i % 2 == 0){
+         std::string weight = "w" + std::to_string(i);
+         std::string bias = "b" + std::to_string(i);
+         node.Bytes(1, weight);
+         node.Bytes(1, bias);
+         node.Bytes(4, "Gemm");
+         graph.Sub(5, Initializer(weight, {kWidth, kWidth}, i));
+         graph.Sub(5, Initializer(bias, {1, kWidth}, i + 1));
+      }else{
+         node.Bytes(4, "Relu");
+      }
+      node.Bytes(2, output);
+      node.Bytes(3, "node" + std::to_string(i));
+      graph.Sub(1, node);
+      previous = output;
+   }
+   graph.Sub(11, ValueInfo("input"));
+   graph.Sub(12, ValueInfo(previous));
+   Message model;
+   model.Int(1, 7);   //ir_version
+   model.Sub(7, graph);
+   std::ofstream f(filename, std::ios::binary);
+   f << model.bytes;
+}
+
+double Seconds(std::chrono::steady_clock::time_point begin){
+   return std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+}
+
+}//anonymous namespace
+
+int main(int argc, char** argv){
+   int max_nodes = argc > 1 ? std::atoi(argv[1]) : 100000;
+   std::printf("%10s %12s %12s %12s %14s\n", "nodes", "parse [s]", "generate [s]", "total [s]", "per node [us]");
+   for (int n_nodes = max_nodes / 16; n_nodes <= max_nodes; n_nodes *= 2){
+      std::string filename = "benchgraph_" + std::to_string(n_nodes) + ".onnx";
+      WriteChain(filename, n_nodes);
+
+      auto begin = std::chrono::steady_clock::now();
+      RModelParser_ONNX parser;
+      RModel model = parser.Parse(filename);
+      double parse = Seconds(begin);
+      auto generate_begin = std::chrono::steady_clock::now();
+      model.Generate();   //runs Initialize
+      double generate = Seconds(generate_begin);
+      double total = parse + generate;
+      std::printf("%10d %12.3f %12.3f %12.3f %14.2f\n", n_nodes, parse, generate, total, total / n_nodes * 1e6);
+      std::remove(filename.c_str());
+   }
+   return 0;
+}
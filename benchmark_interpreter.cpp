@@ -0,0 +1,62 @@
+//in process interpreter against the generated code of the same model: checks that both give the same outputs and
+//compares their latency. MODEL_HEADER is the code generated from MODEL_FILE with the default options (./prototype)
+//usage: benchinterp [number of inferences, default 10000]
+#include MODEL_HEADER
+
+#include "RInterpreter.hxx"
+#include "RModelParser_ONNX.hxx"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace TMVA::Experimental::SOFIE;
+
+int main(int argc, char** argv){
+   int n_inferences = argc > 1 ? std::atoi(argv[1]) : 10000;
+
+   auto begin = std::chrono::steady_clock::now();
+   RModelParser_ONNX parser;
+   RInterpreter interpreter(parser.Parse(MODEL_FILE));
+   double load = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+   //the input length is the one the interpreter reads, taken from the first inference of the generated code
+   std::mt19937 generator(42);
+   std::normal_distribution<float> distribution(0, 1);
+   std::vector<float> input(1 << 20);
+   for (auto& x: input) x = distribution(generator);
+
+   std::vector<float> generated = MODEL_NAMESPACE::infer(input.data());
+   std::vector<float> interpreted = interpreter.Infer(input.data());
+   if (generated.size() != interpreted.size()){
+      std::printf("output length differs: generated %zu, interpreted %zu\n", generated.size(), interpreted.size());
+      return 1;
+   }
+   float max_diff = 0, max_abs = 0;
+   for (std::size_t i = 0; i < generated.size(); i++){
+      max_diff = std::max(max_diff, std::fabs(generated[i] - interpreted[i]));
+      max_abs = std::max(max_abs, std::fabs(generated[i]));
+   }
+   std::printf("%s: load and initialize %.3f ms, arena %zu bytes, max abs difference %g (max abs output %g)\n",
+               MODEL_FILE, load * 1e3, interpreter.GetArenaSize(), max_diff, max_abs);
+
+   double generated_time = 0, interpreted_time = 0;
+   float sink = 0;
+   for (int i = 0; i < n_inferences; i++){
+      auto t0 = std::chrono::steady_clock::now();
+      sink += MODEL_NAMESPACE::infer(input.data())[0];
+      auto t1 = std::chrono::steady_clock::now();
+      sink += interpreter.Infer(input.data())[0];
+      auto t2 = std::chrono::steady_clock::now();
+      generated_time += std::chrono::duration<double>(t1 - t0).count();
+      interpreted_time += std::chrono::duration<double>(t2 - t1).count();
+   }
+   std::printf("%12s %14s\n", "", "per infer [us]");
+   std::printf("%12s %14.2f\n", "generated", generated_time / n_inferences * 1e6);
+   std::printf("%12s %14.2f\n", "interpreted", interpreted_time / n_inferences * 1e6);
+   return sink == 12345.f;   //keeps the inferences from being optimized away
+}
@@ -0,0 +1,339 @@
+//microbenchmarks of the code generated by each operator: every configuration is built as a one operator model,
+//generated for each backend that applies to it (the Options selecting a kernel), compiled with RModel::Compile and timed.
+//The output is checked against the interpreter, which runs the float reference kernels, and the achieved GFLOP/s and
+//GB/s are computed from the operator's FLOPs and from the bytes of its input, weights and output. The FLOPs are those of
+//the dense operation, so the sparse kernels report an effective rate
+//usage: benchkernels [--op gemm|transpose|conv|relu] [--backend name] [--min-time seconds] [--cache dir]
+//                    [--compiler "c++ -O3 -march=native"] [--blas flags] [--json out.json]
+
+#include "RModel.hxx"
+#include "RInterpreter.hxx"
+#include "OperatorList.hxx"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace TMVA::Experimental::SOFIE;
+
+namespace{
+
+using Clock = std::chrono::steady_clock;
+
+struct Settings{
+   std::string op;
+   std::string backend;
+   double min_time = 0.1;
+   std::string cache = "sofie_cache";
+   std::string command = "c++ -O3 -march=native";
+   std::string blas = "-lblas";
+   std::string json;
+};
+
+//a kernel selected at generation time
+struct Backend{
+   std::string name;
+   std::underlying_type_t<Options> options;
+};
+
+//one operator configuration: builds a fresh model each time, and the input the model is run on
+struct Case{
+   std::string op;
+   std::string config;
+   std::function<RModel()> build;
+   std::vector<float> input;
+   std::vector<Backend> backends;
+};
+
+std::underlying_type_t<Options> Flag(Options option){
+   return static_cast<std::underlying_type_t<Options>>(option);
+}
+
+std::shared_ptr<void> RandomData(std::size_t length, std::mt19937& generator, float zeros = 0){
+   std::shared_ptr<void> data(new float[length], std::default_delete<float[]>());
+   std::normal_distribution<float> distribution(0, 1);
+   std::uniform_real_distribution<float> uniform(0, 1);
+   float* x = static_cast<float*>(data.get());
+   for (std::size_t i = 0; i < length; i++) x[i] = uniform(generator) < zeros ? 0 : distribution(generator);
+   return data;
+}
+
+std::vector<float> RandomInput(std::size_t length, float zeros = 0){
+   std::mt19937 generator(7);
+   std::shared_ptr<void> data = RandomData(length, generator, zeros);
+   return std::vector<float>(static_cast<float*>(data.get()), static_cast<float*>(data.get()) + length);
+}
+
+RModel NewModel(std::string name){
+   return RModel(name + ".onnx", "kernel benchmark\n");
+}
+
+//Y = op(X) op(W), X the input of shape (m, k) or (k, m), W the weights of shape (k, n) or (n, k), zeros the fraction of zero weights
+std::function<RModel()> BuildGemm(std::string name, std::size_t m, std::size_t n, std::size_t k, int trans_a, int trans_b, float zeros){
+   return [=](){
+      std::mt19937 generator(1);
+      RModel model = NewModel(name);
+      model.AddInputTensorInfo("X", ETensorType::FLOAT, trans_a ? std::vector<std::size_t>{k, m} : std::vector<std::size_t>{m, k});
+      model.AddInitializedTensor("W", ETensorType::FLOAT, trans_b ? std::vector<std::size_t>{n, k} : std::vector<std::size_t>{k, n},
+                                 RandomData(n * k, generator, zeros));
+      model.AddInitializedTensor("C", ETensorType::FLOAT, {m, n}, RandomData(m * n, generator));
+      model.AddOperator(std::unique_ptr<ROperator>(new ROperator_Gemm<float>(1.0, 1.0, trans_a, trans_b, "X", "W", "C", "Y")));
+      model.AddBlasRoutines({"Gemm", "Sgemv"});   //as declared by the parser
+      model.AddOutputTensorNameList({"Y"});
+      return model;
+   };
+}
+
+//X -> Gemm(W) -> Relu -> Gemm(W), one square weight tensor shared by two layers: a backend converting the weights
+//must leave the float values to the other layer
+std::function<RModel()> BuildTiedGemm(std::string name, std::size_t m, std::size_t n, int trans_b, float zeros){
+   return [=](){
+      std::mt19937 generator(1);
+      RModel model = NewModel(name);
+      model.AddInputTensorInfo("X", ETensorType::FLOAT, std::vector<std::size_t>{m, n});
+      model.AddInitializedTensor("W", ETensorType::FLOAT, {n, n}, RandomData(n * n, generator, zeros));
+      model.AddInitializedTensor("C", ETensorType::FLOAT, {m, n}, RandomData(m * n, generator));
+      model.AddOperator(std::unique_ptr<ROperator>(new ROperator_Gemm<float>(1.0, 1.0, 0, trans_b, "X", "W", "C", "H")));
+      model.AddOperator(std::unique_ptr<ROperator>(new ROperator_Relu<float>("H", "R")));
+      model.AddOperator(std::unique_ptr<ROperator>(new ROperator_Gemm<float>(1.0, 1.0, 0, trans_b, "R", "W", "C", "Y")));
+      model.AddBlasRoutines({"Gemm", "Sgemv"});
+      model.AddOutputTensorNameList({"Y"});
+      return model;
+   };
+}
+
+std::function<RModel()> BuildTranspose(std::string name, std::vector<std::size_t> shape, std::vector<int_t> perm){
+   return [=](){
+      RModel model = NewModel(name);
+      model.AddInputTensorInfo("X", ETensorType::FLOAT, shape);
+      model.AddOperator(std::unique_ptr<ROperator>(new ROperator_Transpose<float>(perm, "X", "Y")));
+      model.AddOutputTensorNameList({"Y"});
+      return model;
+   };
+}
+
+//square kernel, padded to keep the spatial size at stride 1
+std::function<RModel()> BuildConv(std::string name, std::size_t c, std::size_t h, std::size_t m, std::size_t kernel,
+                                  std::size_t stride, std::size_t dilation, std::size_t group){
+   return [=](){
+      std::mt19937 generator(2);
+      RModel model = NewModel(name);
+      std::size_t pad = (kernel - 1) * dilation / 2;
+      model.AddInputTensorInfo("X", ETensorType::FLOAT, std::vector<std::size_t>{1, c, h, h});
+      model.AddInitializedTensor("W", ETensorType::FLOAT, {m, c / group, kernel, kernel}, RandomData(m * c / group * kernel * kernel, generator));
+      model.AddOperator(std::unique_ptr<ROperator>(new ROperator_Conv<float>("NOTSET", {dilation, dilation}, group, {kernel, kernel},
+                                                   {pad, pad, pad, pad}, {stride, stride}, "X", "W", "Y")));
+      model.AddBlasRoutines({"Gemm", "Axpy"});
+      model.AddOutputTensorNameList({"Y"});
+      return model;
+   };
+}
+
+std::function<RModel()> BuildRelu(std::string name, std::size_t length){
+   return [=](){
+      RModel model = NewModel(name);
+      model.AddInputTensorInfo("X", ETensorType::FLOAT, std::vector<std::size_t>{length});
+      model.AddOperator(std::unique_ptr<ROperator>(new ROperator_Relu<float>("X", "Y")));
+      model.AddOutputTensorNameList({"Y"});
+      return model;
+   };
+}
+
+std::vector<Case> MakeCases(){
+   std::vector<Case> cases;
+   const Backend blas = {"blas", 0};
+   //kernels replacing BLAS for initialized weights and a non transposed input
+   const std::vector<Backend> converted = {{"fp16w", Flag(Options::kFloat16Weights)},
+                                           {"bf16w", Flag(Options::kBFloat16Weights)},
+                                           {"int8w", Flag(Options::kInt8Weights)},
+                                           {"int8", Flag(Options::kInt8)}};
+
+   struct GemmSize { std::size_t m, n, k; };
+   for (GemmSize s: std::vector<GemmSize>{{1, 64, 64}, {1, 256, 256}, {1, 1024, 1024}, {16, 256, 256}, {64, 64, 64}, {64, 512, 512}, {256, 256, 256}}){
+      for (int trans = 0; trans < 4; trans++){
+         int trans_a = trans >> 1, trans_b = trans & 1;
+         std::string config = std::to_string(s.m) + "x" + std::to_string(s.n) + "x" + std::to_string(s.k) + (trans_a ? "_t" : "_n") + (trans_b ? "t" : "n");
+         Case c{"gemm", config, BuildGemm("gemm_" + config, s.m, s.n, s.k, trans_a, trans_b, 0),
+                RandomInput(s.m * s.k), {blas}};
+         if (!trans_a) c.backends.insert(c.backends.end(), converted.begin(), converted.end());
+         cases.push_back(c);
+         if (!trans_a){
+            //weights sparse enough for the CSR kernel
+            cases.push_back(Case{"gemm", config + "_sparse90", BuildGemm("gemm_" + config + "_sparse", s.m, s.n, s.k, 0, trans_b, 0.9),
+                                 RandomInput(s.m * s.k), {{"sparsew", 0}}});
+         }
+         if (!trans_a && s.m == 1){
+            cases.push_back(Case{"gemm", config + "_input90", BuildGemm("gemm_" + config + "_sinput", s.m, s.n, s.k, 0, trans_b, 0),
+                                 RandomInput(s.m * s.k, 0.9), {blas, {"sparsein", Flag(Options::kSparseInputs)}}});
+         }
+         if (!trans_a && s.m == 1 && s.n == s.k && s.n <= 256){
+            Case tied{"gemm", config + "_tied", BuildTiedGemm("gemm_" + config + "_tied", s.m, s.n, trans_b, 0), RandomInput(s.m * s.k), {blas}};
+            tied.backends.insert(tied.backends.end(), converted.begin(), converted.end());
+            tied.backends.push_back({"sparsein", Flag(Options::kSparseInputs)});
+            cases.push_back(tied);
+            cases.push_back(Case{"gemm", config + "_tied_sparse90", BuildTiedGemm("gemm_" + config + "_tied_sparse", s.m, s.n, trans_b, 0.9),
+                                 RandomInput(s.m * s.k), {{"sparsew", 0}, {"sparsein", Flag(Options::kSparseInputs)}}});
+         }
+      }
+   }
+
+   struct TransposeCase { std::vector<std::size_t> shape; std::vector<int_t> perm; };
+   for (TransposeCase t: std::vector<TransposeCase>{{{64, 64}, {1, 0}}, {{1024, 1024}, {1, 0}}, {{64, 64, 64}, {0, 2, 1}},
+                                                     {{64, 64, 64}, {1, 0, 2}}, {{64, 64, 64}, {2, 1, 0}}, {{64, 64, 64}, {1, 2, 0}},
+                                                     {{64, 64, 64}, {2, 0, 1}}, {{8, 32, 32, 16}, {0, 3, 1, 2}}, {{8, 16, 32, 32}, {0, 2, 3, 1}}}){
+      std::string config;
+      for (auto d: t.shape) config += (config.empty() ? "" : "x") + std::to_string(d);
+      config += "_p";
+      for (auto p: t.perm) config += std::to_string(p);
+      cases.push_back(Case{"transpose", config, BuildTranspose("transpose_" + config, t.shape, t.perm),
+                           RandomInput(ConvertShapeToLength(t.shape)), {{"loop", 0}}});
+   }
+
+   struct ConvCase { std::size_t c, h, m, kernel, stride, dilation, group; };
+   for (ConvCase v: std::vector<ConvCase>{{3, 32, 16, 3, 1, 1, 1}, {16, 32, 32, 3, 1, 1, 1}, {16, 32, 32, 3, 2, 1, 1}, {16, 32, 32, 3, 1, 2, 1},
+                                          {32, 16, 64, 1, 1, 1, 1}, {32, 16, 32, 5, 1, 1, 1}, {64, 8, 64, 3, 1, 1, 1},
+                                          {16, 32, 16, 3, 1, 1, 4}, {16, 32, 16, 3, 1, 1, 16}}){
+      std::string config = std::to_string(v.c) + "x" + std::to_string(v.h) + "x" + std::to_string(v.h) + "_m" + std::to_string(v.m)
+                           + "_k" + std::to_string(v.kernel) + "_s" + std::to_string(v.stride) + "_d" + std::to_string(v.dilation)
+                           + "_g" + std::to_string(v.group);
+      Case c{"conv", config, BuildConv("conv_" + config, v.c, v.h, v.m, v.kernel, v.stride, v.dilation, v.group),
+             RandomInput(v.c * v.h * v.h), {{"im2col", 0}}};
+      if (v.group == 1) c.backends.push_back({"int8", Flag(Options::kInt8)});
+      cases.push_back(c);
+   }
+
+   for (std::size_t length: {1024, 65536, 1 << 20}){
+      std::string config = std::to_string(length);
+      cases.push_back(Case{"relu", config, BuildRelu("relu_" + config, length), RandomInput(length), {{"loop", 0}}});
+   }
+   return cases;
+}
+
+struct Result{
+   std::string op, config, backend;
+   std::string status = "ok";
+   double us = 0, gflops = 0, gbytes = 0, max_error = -1;
+};
+
+Result Run(const Settings& settings, Case& c, const Backend& backend, const std::vector<float>* reference){
+   Result result{c.op, c.config, backend.name};
+   RModel model = c.build();
+   model.Generate(backend.options);
+   //the input and the output once, and the weights as they are stored
+   OperatorCost cost = model.GetCost();
+   std::size_t flops = cost.flops;
+   std::size_t bytes = cost.GetBytes();
+   RCompiledModel compiled = model.Compile(settings.cache, settings.command, settings.blas);
+
+   std::vector<float> output = compiled.Infer(c.input.data());
+   if (reference != nullptr){
+      float max_abs = 0, max_diff = 0;
+      for (std::size_t i = 0; i < output.size(); i++){
+         max_abs = std::max(max_abs, std::fabs((*reference)[i]));
+         max_diff = std::max(max_diff, std::fabs(output[i] - (*reference)[i]));
+      }
+      result.max_error = max_abs > 0 ? max_diff / max_abs : max_diff;
+   }
+
+   //median of batches of calls, each batch long enough for the clock
+   std::size_t calls = 1;
+   for (;;){
+      auto t0 = Clock::now();
+      for (std::size_t i = 0; i < calls; i++) compiled.Infer(c.input.data());
+      if (std::chrono::duration<double>(Clock::now() - t0).count() > 1e-3 || calls > (1 << 20)) break;
+      calls *= 2;
+   }
+   std::vector<double> times;
+   auto begin = Clock::now();
+   while (times.size() < 5 || std::chrono::duration<double>(Clock::now() - begin).count() < settings.min_time){
+      auto t0 = Clock::now();
+      for (std::size_t i = 0; i < calls; i++) compiled.Infer(c.input.data());
+      times.push_back(std::chrono::duration<double>(Clock::now() - t0).count() / calls);
+   }
+   std::sort(times.begin(), times.end());
+   double seconds = times[times.size() / 2];
+   result.us = seconds * 1e6;
+   result.gflops = flops / seconds * 1e-9;
+   result.gbytes = bytes / seconds * 1e-9;
+   return result;
+}
+
+std::string ToJson(const Result& r){
+   std::string status = r.status;
+   std::replace(status.begin(), status.end(), '"', '\'');
+   char line[1024];
+   std::snprintf(line, sizeof(line), "{\"op\": \"%s\", \"config\": \"%s\", \"backend\": \"%s\", \"status\": \"%s\", \"us\": %g, "
+                 "\"gflops\": %g, \"gbytes\": %g, \"max_rel_error\": %g}", r.op.c_str(), r.config.c_str(), r.backend.c_str(),
+                 status.c_str(), r.us, r.gflops, r.gbytes, r.max_error);
+   return line;
+}
+
+}//anonymous namespace
+
+int main(int argc, char** argv){
+   Settings settings;
+   for (int i = 1; i < argc; i++){
+      std::string arg = argv[i];
+      bool has_value = i + 1 < argc;
+      if (arg == "--op" && has_value) settings.op = argv[++i];
+      else if (arg == "--backend" && has_value) settings.backend = argv[++i];
+      else if (arg == "--min-time" && has_value) settings.min_time = std::atof(argv[++i]);
+      else if (arg == "--cache" && has_value) settings.cache = argv[++i];
+      else if (arg == "--compiler" && has_value) settings.command = argv[++i];
+      else if (arg == "--blas" && has_value) settings.blas = argv[++i];
+      else if (arg == "--json" && has_value) settings.json = argv[++i];
+      else{
+         std::printf("unknown argument %s, see the usage at the top of benchmark_kernels.cpp\n", arg.c_str());
+         return 2;
+      }
+   }
+
+   std::printf("compiler: %s, kernels for %s\n", settings.command.c_str(), RCompiledModel::GetTargetFeatures(settings.command).c_str());
+   std::vector<Result> results;
+   std::printf("%-10s %-28s %-9s %10s %9s %9s %10s\n", "op", "config", "backend", "time[us]", "GFLOP/s", "GB/s", "rel.error");
+   for (auto& c: MakeCases()){
+      if (!settings.op.empty() && c.op != settings.op) continue;
+      //float reference, where the interpreter supports the configuration
+      std::unique_ptr<std::vector<float>> reference;
+      try{
+         RInterpreter interpreter(c.build());
+         reference.reset(new std::vector<float>(interpreter.Infer(c.input.data())));
+      }catch (std::exception&){
+      }
+      for (auto& backend: c.backends){
+         if (!settings.backend.empty() && backend.name != settings.backend) continue;
+         Result r{c.op, c.config, backend.name};
+         try{
+            r = Run(settings, c, backend, reference.get());
+         }catch (std::exception& e){
+            r.status = e.what();
+         }
+         if (r.status != "ok"){
+            std::printf("%-10s %-28s %-9s failed: %s\n", r.op.c_str(), r.config.c_str(), r.backend.c_str(), r.status.c_str());
+         }else{
+            std::printf("%-10s %-28s %-9s %10.2f %9.2f %9.2f ", r.op.c_str(), r.config.c_str(), r.backend.c_str(), r.us, r.gflops, r.gbytes);
+            if (r.max_error < 0) std::printf("%10s\n", "n/a");
+            else std::printf("%10.2g\n", r.max_error);
+         }
+         results.push_back(r);
+      }
+   }
+
+   if (!settings.json.empty()){
+      std::ofstream out(settings.json);
+      out << "[\n";
+      for (std::size_t i = 0; i < results.size(); i++){
+         out << ToJson(results[i]) << (i + 1 < results.size() ? ",\n" : "\n");
+      }
+      out << "]\n";
+   }
+   return 0;
+}
@@ -0,0 +1,564 @@
+//end to end latency and throughput of every .onnx model of a directory: each model is parsed, generated and compiled
+//with RModel::Compile (the libraries are cached in the cache directory), then timed through its compiled entry point.
+//cold is the first inference after loading the library, warm the distribution of the following ones; throughput runs
+//threads in parallel, each on its own copy of the library since the generated code keeps its intermediates static.
+//The results are written as JSON, one model per line, and can be compared to such a file from an earlier run.
+//--roofline also builds each model with Options::kProfile and places every operator on the roofline: its FLOPs and
+//bytes moved (RModel::GetOperatorCosts) over its profiled time give GFLOP/s and GB/s, compared to the attainable rate
+//min(peak GFLOP/s, FLOP/byte * peak GB/s). The memory roof is measured by a streaming read unless --peak-gbs is given,
+//the compute roof only comes from --peak-gflops. The bytes are those an operator has to move at least, operators
+//whose tensors stay in cache can exceed the memory roof.
+//--counters reads the perf_event_open counters of RPerfCounters around every warm inference, and with --roofline
+//around every operator, and reports their mean per call. Those the CPU or the kernel does not provide are left out
+//--accuracy compares the output of each compiled model to that of RInterpreter with the float weights on random inputs,
+//which measures what --options converting the weights (e.g. 4 for fp16, 8 for bf16) cost at the output
+//usage: benchmodels [--iterations n] [--warmup n] [--flush MB] [--threads 1,2,4] [--options n] [--cache dir]
+//                   [--compiler "c++ -O3 -march=native"] [--blas flags] [--json out.json] [--baseline old.json] [--tolerance 0.1]
+//                   [--roofline] [--peak-gflops x] [--peak-gbs x] [--counters] [--accuracy] directory
+
+#include "RModel.hxx"
+#include "RInterpreter.hxx"
+#include "RModelParser_ONNX.hxx"
+#include "RPerfCounters.hxx"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <dirent.h>
+
+using namespace TMVA::Experimental::SOFIE;
+
+namespace{
+
+using Clock = std::chrono::steady_clock;
+
+struct Settings{
+   int iterations = 10000;
+   int warmup = 1000;
+   std::size_t flush_bytes = 0;         //evicts the caches before every timed warm inference when non zero
+   std::vector<int> threads = {1};
+   std::underlying_type_t<Options> options = 0;
+   std::string cache = "sofie_cache";
+   std::string command = "c++ -O3 -march=native";
+   std::string blas = "-lblas";
+   std::string json;
+   std::string baseline;
+   double tolerance = 0.1;
+   bool roofline = false;
+   double peak_gflops = 0;              //unknown when 0
+   double peak_gbs = 0;                 //measured when 0
+   const RPerfCounters* counters = nullptr;   //with --counters, opened by the thread running the inferences
+   bool accuracy = false;
+   std::string directory;
+};
+
+struct OperatorResult{
+   OperatorCost cost;
+   double us = 0;                       //mean of the profiled calls
+   std::vector<double> counters;        //mean per call, indexed by RPerfCounters::ECounter
+};
+
+struct Result{
+   std::string model;
+   std::size_t batch = 0;
+   double compile_ms = 0;
+   bool from_cache = false;
+   double cold_us = 0;
+   double mean_us = 0, p50_us = 0, p90_us = 0, p99_us = 0, p999_us = 0, max_us = 0;
+   std::vector<std::pair<int, double>> throughput;   //(threads, samples per second)
+   std::size_t flops = 0, bytes = 0;
+   std::vector<double> counters;                     //with --counters, mean per warm inference
+   std::vector<OperatorResult> ops;                  //with --roofline
+   std::vector<std::pair<std::string, OutputAccuracyInfo>> outputs;   //with --accuracy
+   std::string accuracy_error;                       //why the outputs could not be checked
+};
+
+double Microseconds(Clock::duration d){
+   return std::chrono::duration<double, std::micro>(d).count();
+}
+
+//nearest rank on sorted samples
+double Percentile(const std::vector<double>& sorted, double p){
+   std::size_t rank = static_cast<std::size_t>(p / 100 * sorted.size() + 0.999999);
+   return sorted[std::min(sorted.size(), std::max<std::size_t>(rank, 1)) - 1];
+}
+
+//a write to every cache line of a buffer larger than the last level cache
+void FlushCaches(std::vector<char>& buffer){
+   for (std::size_t i = 0; i < buffer.size(); i += 64) buffer[i]++;
+}
+
+//GB/s of the best of five reads of 256 MB, with independent sums to keep several loads in flight
+double MeasureBandwidth(){
+   std::vector<std::uint64_t> buffer(std::size_t(32) << 20, 1);
+   double best = 0;
+   std::uint64_t check = 0;
+   for (int repeat = 0; repeat < 5; repeat++){
+      auto t0 = Clock::now();
+      std::uint64_t s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+      for (std::size_t i = 0; i < buffer.size(); i += 4){
+         s0 += buffer[i];
+         s1 += buffer[i + 1];
+         s2 += buffer[i + 2];
+         s3 += buffer[i + 3];
+      }
+      double seconds = std::chrono::duration<double>(Clock::now() - t0).count();
+      check += s0 + s1 + s2 + s3;
+      best = std::max(best, buffer.size() * sizeof(std::uint64_t) / seconds * 1e-9);
+   }
+   return check > 0 ? best : 0;
+}
+
+//attainable GFLOP/s of an operator under the roofs, 0 when it does no floating point work
+double Roof(const Settings& settings, const OperatorCost& cost){
+   double roof = cost.GetIntensity() * settings.peak_gbs;
+   return settings.peak_gflops > 0 ? std::min(roof, settings.peak_gflops) : roof;
+}
+
+std::vector<std::string> ListModels(const std::string& directory){
+   std::vector<std::string> files;
+   DIR* dir = opendir(directory.c_str());
+   if (dir == nullptr){
+      throw std::runtime_error("cannot open directory " + directory);
+   }
+   while (dirent* entry = readdir(dir)){
+      std::string name = entry->d_name;
+      if (name.size() > 5 && name.compare(name.size() - 5, 5, ".onnx") == 0) files.push_back(name);
+   }
+   closedir(dir);
+   std::sort(files.begin(), files.end());
+   return files;
+}
+
+void CopyFile(const std::string& from, const std::string& to){
+   std::ifstream in(from, std::ios::in | std::ios::binary);
+   std::ofstream out(to, std::ios::out | std::ios::binary);
+   out << in.rdbuf();
+   if (!in || !out){
+      throw std::runtime_error("cannot copy " + from + " to " + to);
+   }
+}
+
+//the library loaded again from a copy: a separate instance of the generated code and of its static tensors
+RCompiledModel LoadCopy(const RCompiledModel& compiled, const std::string& suffix){
+   std::string path = compiled.GetLibraryPath() + suffix;
+   CopyFile(compiled.GetLibraryPath(), path);
+   std::vector<std::vector<std::size_t>> shapes;
+   for (std::size_t i = 0; i < compiled.GetNumInputs(); i++) shapes.push_back(compiled.GetInputShape(i));
+   RCompiledModel copy(path, compiled.GetSymbol(), shapes, compiled.GetOutputLength(), true);
+   std::remove(path.c_str());   //stays mapped until unloaded
+   return copy;
+}
+
+std::vector<std::vector<float>> MakeInputs(const RCompiledModel& compiled){
+   std::mt19937 generator(42);
+   std::normal_distribution<float> distribution(0, 1);
+   std::vector<std::vector<float>> inputs;
+   for (std::size_t i = 0; i < compiled.GetNumInputs(); i++){
+      inputs.emplace_back(ConvertShapeToLength(compiled.GetInputShape(i)));
+      for (auto& x: inputs.back()) x = distribution(generator);
+   }
+   return inputs;
+}
+
+//samples per second of n threads, each inferring on its own copy of the library for about a quarter of a second
+double Throughput(const RCompiledModel& compiled, int n, std::size_t batch){
+   std::vector<RCompiledModel> copies;
+   for (int t = 0; t < n; t++){
+      copies.push_back(LoadCopy(compiled, ".thread" + std::to_string(t)));
+   }
+   std::vector<std::vector<float>> inputs = MakeInputs(compiled);
+   std::vector<const float*> pointers;
+   for (auto& input: inputs) pointers.push_back(input.data());
+
+   std::atomic<bool> start{false}, stop{false};
+   std::vector<long> counts(n, 0);
+   std::vector<std::thread> workers;
+   for (int t = 0; t < n; t++){
+      workers.emplace_back([&, t](){
+         while (!start) std::this_thread::yield();
+         long count = 0;
+         while (!stop){
+            copies[t].Infer(pointers);
+            count++;
+         }
+         counts[t] = count;
+      });
+   }
+   auto begin = Clock::now();
+   start = true;
+   std::this_thread::sleep_for(std::chrono::milliseconds(250));
+   stop = true;
+   for (auto& w: workers) w.join();
+   double seconds = std::chrono::duration<double>(Clock::now() - begin).count();
+   long total = 0;
+   for (auto c: counts) total += c;
+   return total * batch / seconds;
+}
+
+Result Run(const Settings& settings, const std::string& file){
+   Result result;
+   result.model = file.substr(0, file.size() - 5);
+
+   auto begin = Clock::now();
+   RModelParser_ONNX parser;
+   RModel model = parser.Parse(settings.directory + "/" + file);
+   model.Generate(settings.options);
+   RCompiledModel compiled = model.Compile(settings.cache, settings.command, settings.blas);
+   result.compile_ms = Microseconds(Clock::now() - begin) / 1e3;
+   result.from_cache = compiled.IsFromCache();
+   //the leading dimension of the first input
+   result.batch = compiled.GetNumInputs() == 0 || compiled.GetInputShape(0).empty() ? 1 : compiled.GetInputShape(0)[0];
+
+   //cold: first call into a freshly loaded copy, weights and code not yet touched
+   std::vector<std::vector<float>> inputs = MakeInputs(compiled);
+   std::vector<const float*> pointers;
+   for (auto& input: inputs) pointers.push_back(input.data());
+   {
+      RCompiledModel cold = LoadCopy(compiled, ".cold");
+      auto t0 = Clock::now();
+      cold.Infer(pointers);
+      result.cold_us = Microseconds(Clock::now() - t0);
+   }
+
+   std::vector<char> flush(settings.flush_bytes);
+   for (int i = 0; i < settings.warmup; i++) compiled.Infer(pointers);
+   std::vector<double> samples(settings.iterations);
+   //counters are read outside of the timed region
+   std::vector<std::uint64_t> before(RPerfCounters::kNumCounters), after(RPerfCounters::kNumCounters);
+   std::vector<std::uint64_t> counted(RPerfCounters::kNumCounters, 0);
+   for (auto& sample: samples){
+      if (!flush.empty()) FlushCaches(flush);
+      if (settings.counters) settings.counters->Read(before.data());
+      auto t0 = Clock::now();
+      compiled.Infer(pointers);
+      sample = Microseconds(Clock::now() - t0);
+      if (settings.counters){
+         settings.counters->Read(after.data());
+         for (int k = 0; k < RPerfCounters::kNumCounters; k++) counted[k] += after[k] - before[k];
+      }
+   }
+   if (settings.counters){
+      for (auto c: counted) result.counters.push_back(static_cast<double>(c) / settings.iterations);
+   }
+   double sum = 0;
+   for (auto s: samples) sum += s;
+   std::sort(samples.begin(), samples.end());
+   result.mean_us = sum / samples.size();
+   result.p50_us = Percentile(samples, 50);
+   result.p90_us = Percentile(samples, 90);
+   result.p99_us = Percentile(samples, 99);
+   result.p999_us = Percentile(samples, 99.9);
+   result.max_us = samples.back();
+
+   for (int n: settings.threads){
+      result.throughput.emplace_back(n, Throughput(compiled, n, result.batch));
+   }
+   OperatorCost cost = model.GetCost();
+   result.flops = cost.flops;
+   result.bytes = cost.GetBytes();
+
+   if (settings.accuracy){
+      try{
+         RInterpreter reference(parser.Parse(settings.directory + "/" + file));
+         model.CheckOutputAccuracy(reference, compiled);
+         for (auto& it: model.GetOutputAccuracy()) result.outputs.push_back(it);
+      }catch (std::exception& e){
+         result.accuracy_error = e.what();
+      }
+   }
+   return result;
+}
+
+//time of every operator from a build generated with Options::kProfile, run as the warm inferences
+void RunProfiled(const Settings& settings, const std::string& file, Result& result){
+   RModelParser_ONNX parser;
+   RModel model = parser.Parse(settings.directory + "/" + file);
+   model.Generate(settings.options | Options::kProfile);
+   RCompiledModel compiled = model.Compile(settings.cache, settings.command, settings.blas);
+   std::vector<OperatorCost> costs = model.GetOperatorCosts();
+   if (settings.counters) compiled.SetProfileCounters(settings.counters);
+
+   std::vector<std::vector<float>> inputs = MakeInputs(compiled);
+   std::vector<const float*> pointers;
+   for (auto& input: inputs) pointers.push_back(input.data());
+   std::vector<char> flush(settings.flush_bytes);
+   for (int i = 0; i < settings.warmup; i++) compiled.Infer(pointers);
+   compiled.GetProfile(true);
+   for (int i = 0; i < settings.iterations; i++){
+      if (!flush.empty()) FlushCaches(flush);
+      compiled.Infer(pointers);
+   }
+   std::vector<RCompiledModel::ProfileEntry> profile = compiled.GetProfile();
+   for (std::size_t id = 0; id < costs.size() && id < profile.size(); id++){
+      double us = profile[id].calls > 0 ? profile[id].ns / profile[id].calls * 1e-3 : 0;
+      result.ops.push_back({costs[id], us});
+      for (auto c: profile[id].counters){
+         result.ops.back().counters.push_back(profile[id].calls > 0 ? static_cast<double>(c) / profile[id].calls : 0);
+      }
+   }
+   if (settings.counters) compiled.SetProfileCounters(nullptr);
+}
+
+//the available counters of values, with the instructions per cycle when both are there
+void PrintCounters(const Settings& settings, const std::vector<double>& values){
+   for (int k = 0; k < RPerfCounters::kNumCounters; k++){
+      if (settings.counters->IsAvailable(k)) std::printf(" %12.4g", values[k]);
+   }
+   if (settings.counters->IsAvailable(RPerfCounters::kCycles) && settings.counters->IsAvailable(RPerfCounters::kInstructions)){
+      std::printf(" %6.2f", values[RPerfCounters::kCycles] > 0 ? values[RPerfCounters::kInstructions] / values[RPerfCounters::kCycles] : 0);
+   }
+   std::printf("\n");
+}
+
+void PrintCounterHeader(const Settings& settings, const char* first){
+   std::printf("  %-24s", first);
+   for (int k = 0; k < RPerfCounters::kNumCounters; k++){
+      if (settings.counters->IsAvailable(k)) std::printf(" %12s", RPerfCounters::GetName(k));
+   }
+   if (settings.counters->IsAvailable(RPerfCounters::kCycles) && settings.counters->IsAvailable(RPerfCounters::kInstructions)){
+      std::printf(" %6s", "IPC");
+   }
+   std::printf("\n");
+}
+
+std::string CountersToJson(const Settings& settings, const std::vector<double>& values){
+   std::ostringstream out;
+   out.precision(6);
+   out << "{";
+   bool first = true;
+   for (int k = 0; k < RPerfCounters::kNumCounters; k++){
+      if (!settings.counters->IsAvailable(k)) continue;
+      out << (first ? "" : ", ") << "\"" << RPerfCounters::GetName(k) << "\": " << values[k];
+      first = false;
+   }
+   out << "}";
+   return out.str();
+}
+
+void PrintRoofline(const Settings& settings, const Result& r){
+   std::printf("  %-8s %-10s %-12s %10s %10s %8s %9s %9s %9s %6s %s\n", "op", "type", "output", "MFLOP", "kB", "FLOP/B",
+               "time[us]", "GFLOP/s", "GB/s", "roof", "bound");
+   for (auto& op: r.ops){
+      const OperatorCost& c = op.cost;
+      double gflops = op.us > 0 ? c.flops / op.us * 1e-3 : 0;
+      double gbs = op.us > 0 ? c.GetBytes() / op.us * 1e-3 : 0;
+      double roof = Roof(settings, c);
+      //an operator without floating point work is only bound by memory
+      double fraction = c.flops > 0 ? (roof > 0 ? gflops / roof : 0) : gbs / settings.peak_gbs;
+      std::string bound = c.flops == 0 || (settings.peak_gflops > 0 && roof < settings.peak_gflops) ? "memory"
+                          : settings.peak_gflops > 0 ? "compute" : "-";
+      std::printf("  %-8s %-10s %-12s %10.3f %10.1f %8.2f %9.2f %9.2f %9.2f %5.0f%% %s\n", c.name.c_str(), c.op_type.c_str(),
+                  c.output.c_str(), c.flops * 1e-6, c.GetBytes() * 1e-3, c.GetIntensity(), op.us, gflops, gbs,
+                  fraction * 100, bound.c_str());
+   }
+   if (settings.counters){
+      PrintCounterHeader(settings, "counters per call");
+      for (auto& op: r.ops){
+         std::printf("  %-8s %-15s", op.cost.name.c_str(), op.cost.op_type.c_str());
+         PrintCounters(settings, op.counters);
+      }
+   }
+}
+
+std::string ToJson(const Settings& settings, const Result& r){
+   std::ostringstream out;
+   out.precision(6);
+   out << "{\"model\": \"" << r.model << "\", \"batch\": " << r.batch << ", \"options\": " << settings.options
+       << ", \"compile_ms\": " << r.compile_ms << ", \"from_cache\": " << (r.from_cache ? "true" : "false")
+       << ", \"flush_bytes\": " << settings.flush_bytes << ", \"iterations\": " << settings.iterations
+       << ", \"cold_us\": " << r.cold_us << ", \"mean_us\": " << r.mean_us << ", \"p50_us\": " << r.p50_us
+       << ", \"p90_us\": " << r.p90_us << ", \"p99_us\": " << r.p99_us << ", \"p999_us\": " << r.p999_us
+       << ", \"max_us\": " << r.max_us << ", \"flops\": " << r.flops << ", \"bytes\": " << r.bytes
+       << ", \"gflops\": " << r.flops / r.mean_us * 1e-3 << ", \"gbs\": " << r.bytes / r.mean_us * 1e-3 << ", \"throughput\": [";
+   for (std::size_t i = 0; i < r.throughput.size(); i++){
+      out << (i > 0 ? ", " : "") << "{\"threads\": " << r.throughput[i].first << ", \"samples_per_s\": " << r.throughput[i].second << "}";
+   }
+   out << "]";
+   if (settings.counters) out << ", \"counters\": " << CountersToJson(settings, r.counters);
+   if (settings.roofline){
+      out << ", \"peak_gflops\": " << settings.peak_gflops << ", \"peak_gbs\": " << settings.peak_gbs << ", \"ops\": [";
+      for (std::size_t i = 0; i < r.ops.size(); i++){
+         const OperatorCost& c = r.ops[i].cost;
+         out << (i > 0 ? ", " : "") << "{\"op\": \"" << c.name << "\", \"type\": \"" << c.op_type << "\", \"output\": \"" << c.output
+             << "\", \"flops\": " << c.flops << ", \"weight_bytes\": " << c.weight_bytes << ", \"input_bytes\": " << c.input_bytes
+             << ", \"output_bytes\": " << c.output_bytes << ", \"us\": " << r.ops[i].us << ", \"roof_gflops\": " << Roof(settings, c);
+         if (settings.counters) out << ", \"counters\": " << CountersToJson(settings, r.ops[i].counters);
+         out << "}";
+      }
+      out << "]";
+   }
+   out << "}";
+   return out.str();
+}
+
+//value of a number or string field in a line written by ToJson
+std::string Field(const std::string& line, const std::string& key){
+   std::size_t pos = line.find("\"" + key + "\": ");
+   if (pos == std::string::npos) return "";
+   pos += key.size() + 4;
+   if (line[pos] == '"') return line.substr(pos + 1, line.find('"', pos + 1) - pos - 1);
+   return line.substr(pos, line.find_first_of(",}", pos) - pos);
+}
+
+//per model, the percentiles and settings of the baseline run
+std::map<std::string, std::map<std::string, double>> ReadBaseline(const std::string& filename){
+   std::ifstream in(filename);
+   if (!in.is_open()){
+      throw std::runtime_error("cannot open baseline " + filename);
+   }
+   std::map<std::string, std::map<std::string, double>> baseline;
+   std::string line;
+   while (std::getline(in, line)){
+      std::string model = Field(line, "model");
+      if (model.empty()) continue;
+      for (std::string key: {"p50_us", "p90_us", "p99_us", "options", "flush_bytes"}){
+         baseline[model][key] = std::atof(Field(line, key).c_str());
+      }
+   }
+   return baseline;
+}
+
+std::vector<int> ParseList(const std::string& list){
+   std::vector<int> values;
+   std::stringstream in(list);
+   std::string item;
+   while (std::getline(in, item, ',')) values.push_back(std::atoi(item.c_str()));
+   return values;
+}
+
+}//anonymous namespace
+
+int main(int argc, char** argv){
+   Settings settings;
+   bool use_counters = false;
+   for (int i = 1; i < argc; i++){
+      std::string arg = argv[i];
+      bool has_value = i + 1 < argc;
+      if (arg == "--iterations" && has_value) settings.iterations = std::atoi(argv[++i]);
+      else if (arg == "--warmup" && has_value) settings.warmup = std::atoi(argv[++i]);
+      else if (arg == "--flush" && has_value) settings.flush_bytes = std::atol(argv[++i]) << 20;
+      else if (arg == "--threads" && has_value) settings.threads = ParseList(argv[++i]);
+      else if (arg == "--options" && has_value) settings.options = std::atoi(argv[++i]);
+      else if (arg == "--cache" && has_value) settings.cache = argv[++i];
+      else if (arg == "--compiler" && has_value) settings.command = argv[++i];
+      else if (arg == "--blas" && has_value) settings.blas = argv[++i];
+      else if (arg == "--json" && has_value) settings.json = argv[++i];
+      else if (arg == "--baseline" && has_value) settings.baseline = argv[++i];
+      else if (arg == "--tolerance" && has_value) settings.tolerance = std::atof(argv[++i]);
+      else if (arg == "--roofline") settings.roofline = true;
+      else if (arg == "--peak-gflops" && has_value) settings.peak_gflops = std::atof(argv[++i]);
+      else if (arg == "--peak-gbs" && has_value) settings.peak_gbs = std::atof(argv[++i]);
+      else if (arg == "--counters") use_counters = true;
+      else if (arg == "--accuracy") settings.accuracy = true;
+      else if (arg[0] != '-') settings.directory = arg;
+      else{
+         std::printf("unknown argument %s, see the usage at the top of benchmark_models.cpp\n", arg.c_str());
+         return 2;
+      }
+   }
+   if (settings.directory.empty() || settings.iterations <= 0 || settings.threads.empty()){
+      std::printf("usage: %s [options] directory, see the top of benchmark_models.cpp\n", argv[0]);
+      return 2;
+   }
+
+   std::unique_ptr<RPerfCounters> counters;
+   if (use_counters){
+      counters.reset(new RPerfCounters());
+      if (counters->AnyAvailable()){
+         settings.counters = counters.get();
+         if (!counters->GetError().empty()) std::printf("some counters are unavailable (%s)\n", counters->GetError().c_str());
+      }else{
+         std::printf("no counter available (%s), --counters ignored\n", counters->GetError().c_str());
+      }
+   }
+   std::printf("compiler: %s, kernels for %s\n", settings.command.c_str(), RCompiledModel::GetTargetFeatures(settings.command).c_str());
+   if (settings.roofline && settings.peak_gbs <= 0){
+      settings.peak_gbs = MeasureBandwidth();
+   }
+   if (settings.roofline){
+      std::printf("roofline at %.1f GB/s", settings.peak_gbs);
+      if (settings.peak_gflops > 0) std::printf(" and %.1f GFLOP/s, ridge at %.2f FLOP/B", settings.peak_gflops,
+                                                settings.peak_gflops / settings.peak_gbs);
+      std::printf("\n");
+   }
+
+   std::vector<Result> results;
+   std::printf("%-16s %6s %11s %9s %9s %9s %9s %9s %9s", "model", "batch", "compile[ms]", "cold[us]", "mean[us]",
+               "p50[us]", "p90[us]", "p99[us]", "p99.9[us]");
+   for (int n: settings.threads) std::printf(" %8s@%-2d", "sample/s", n);
+   std::printf("\n");
+   for (auto& file: ListModels(settings.directory)){
+      try{
+         Result result = Run(settings, file);
+         if (settings.roofline) RunProfiled(settings, file, result);
+         results.push_back(result);
+      }catch (std::exception& e){
+         std::printf("%-16s skipped: %s\n", file.c_str(), e.what());
+         continue;
+      }
+      const Result& r = results.back();
+      std::printf("%-16s %6zu %11.1f %9.2f %9.2f %9.2f %9.2f %9.2f %9.2f", r.model.c_str(), r.batch, r.compile_ms, r.cold_us,
+                  r.mean_us, r.p50_us, r.p90_us, r.p99_us, r.p999_us);
+      for (auto& t: r.throughput) std::printf(" %11.0f", t.second);
+      std::printf("\n");
+      if (settings.counters){
+         PrintCounterHeader(settings, "counters per inference");
+         std::printf("  %-24s", "");
+         PrintCounters(settings, r.counters);
+      }
+      if (settings.roofline) PrintRoofline(settings, r);
+      if (!r.accuracy_error.empty()) std::printf("  accuracy not checked: %s\n", r.accuracy_error.c_str());
+      for (auto& o: r.outputs){
+         std::printf("  output %-17s max abs error %.3g, rms error %.3g, relative rms error %.3g over %zu samples\n",
+                     o.first.c_str(), o.second.max_abs_error, o.second.rms_error,
+                     o.second.rms > 0 ? o.second.rms_error / o.second.rms : 0., o.second.samples);
+      }
+   }
+
+   if (!settings.json.empty()){
+      std::ofstream out(settings.json);
+      out << "[\n";
+      for (std::size_t i = 0; i < results.size(); i++){
+         out << ToJson(settings, results[i]) << (i + 1 < results.size() ? ",\n" : "\n");
+      }
+      out << "]\n";
+   }
+
+   //a percentile slower than the baseline by more than the tolerance is a regression, and fails the run
+   int regressions = 0;
+   if (!settings.baseline.empty()){
+      auto baseline = ReadBaseline(settings.baseline);
+      for (auto& r: results){
+         auto b = baseline.find(r.model);
+         if (b == baseline.end()) continue;
+         if (b->second["options"] != settings.options || b->second["flush_bytes"] != settings.flush_bytes){
+            std::printf("%s: baseline measured with other options or cache flushing, not compared\n", r.model.c_str());
+            continue;
+         }
+         std::map<std::string, double> current = {{"p50_us", r.p50_us}, {"p90_us", r.p90_us}, {"p99_us", r.p99_us}};
+         for (auto& c: current){
+            double reference = b->second[c.first];
+            if (reference > 0 && c.second > reference * (1 + settings.tolerance)){
+               std::printf("REGRESSION %s %s: %.2f us, baseline %.2f us (+%.0f%%)\n", r.model.c_str(), c.first.c_str(),
+                           c.second, reference, (c.second / reference - 1) * 100);
+               regressions++;
+            }
+         }
+      }
+      std::printf("%d regressions against %s at tolerance %g\n", regressions, settings.baseline.c_str(), settings.tolerance);
+   }
+   return regressions > 0;
+}
@@ -0,0 +1,40 @@
+//Collects activation ranges for int8 quantization (Options::kInt8)
+//MODEL_HEADER must be generated with Options::kCalibration; a sample is the raw float32 graph inputs back to back, in the
+//order of the arguments of infer, and samples are stored back to back
+//usage: ./calibrate samples.bin calibration.txt, then RModel::ReadCalibration("calibration.txt") before Generate
+#include MODEL_HEADER
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+
+int main(int argc, char** argv){
+   if (argc != 3){
+      std::cout << "usage: " << argv[0] << " samples.bin calibration.txt" << std::endl;
+      return 1;
+   }
+   //graph inputs come first in the ranges
+   std::vector<std::vector<float>> inputs(MODEL_NAMESPACE::Calibration::n_inputs);
+   std::vector<float*> pointers;
+   for (std::size_t i = 0; i < inputs.size(); i++){
+      inputs[i].resize(MODEL_NAMESPACE::Calibration::ranges[i].length);
+      pointers.push_back(inputs[i].data());
+   }
+   std::ifstream samples(argv[1], std::ios::in | std::ios::binary);
+   if (!samples.is_open()){
+      std::cout << "cannot open sample file " << argv[1] << std::endl;
+      return 1;
+   }
+
+   int n = 0;
+   while (true){
+      for (auto& input: inputs){
+         samples.read(reinterpret_cast<char*>(input.data()), input.size() * sizeof(float));
+      }
+      if (!samples) break;
+      MODEL_NAMESPACE::Calibration::run(pointers.data());
+      n++;
+   }
+   MODEL_NAMESPACE::Calibration::write(argv[2]);
+   std::cout << "calibrated on " << n << " samples" << std::endl;
+}